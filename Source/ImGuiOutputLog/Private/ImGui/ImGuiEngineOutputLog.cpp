@@ -3,115 +3,479 @@
 #include "ImGui/ImGuiEngineOutputLog.h"
 
 #include "ImGuiModule.h"
+#include "ImGuiOutputLog.h"
+#include "ImGuiOutputLogStats.h"
 #include "imgui_internal.h"
 #include "ImGui/ImGuiOutputLogFilter.h"
 #include "ImGui/ImGuiOutputLogMessage.h"
+#include "ImGui/ImGuiOutputLogAlerts.h"
 #include "ImGui/ImGuiOutputLogBuffer.h"
-
-class FImGuiEngineLogImpl
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGui/ImGuiOutputLogDeadline.h"
+#include "ImGui/ImGuiOutputLogDetachedView.h"
+#include "ImGui/ImGuiOutputLogExporter.h"
+#include "ImGui/ImGuiOutputLogFileSource.h"
+#include "ImGui/ImGuiOutputLogMinimap.h"
+#include "ImGui/ImGuiOutputLogSharedRing.h"
+#include "ImGui/ImGuiOutputLogStore.h"
+#include "ImGui/ImGuiOutputLogThreads.h"
+#include "ImGui/ImGuiOutputLogTrigramIndex.h"
+#include "ImGui/ImGuiOutputLogWrapLayout.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+class FImGuiEngineLogImpl;
+
+/**
+ * One log window. The messages themselves live in a store shared with the other views; a view only keeps its filter
+ * and the lines that passed it, so its memory grows with the matches rather than with the log.
+ */
+class FImGuiEngineLogView
 {
 public:
-	FImGuiEngineLogImpl();
+	FImGuiEngineLogView(FImGuiEngineLogImpl& InOwner, int32 Id, const char* Title);
+	~FImGuiEngineLogView();
 
-	bool Tick();
+	/** Returns false once the window has been closed. */
+	bool Tick(double Deadline);
+
+	bool NeedsIndexing() const;
+	void IndexInBackground();
 
-	void AddNewMessages();
-	void AddMessage(const ImGui::Private::TMessageRef Message);
+	int32 GetPendingMessagesNum() const;
+	int32 GetSourceMessagesNum() const;
+	const TArray<ImGui::Private::TMessageRef>& GetSourceMessages() const;
 
 	bool DrawVerbosities();
+	void DrawRange();
+	void DrawExport();
+	void DrawLogFile();
+	void DrawNewView();
+	void DrawStats();
+	void DrawFrames();
+	void DrawHitches();
 	void DrawAllMessages();
-
-	void DrawMessage(int32 Index) const;
-	void FormatMessage(ImGui::Private::TMessageRef Message) const;
-
-	void ValidateMessages();
+	void DrawWrappedMessages();
+
+	void DrawFrameSeparator(int32 Line);
+	void DrawMessage(int32 Index, int32 WrappedRow = INDEX_NONE);
+	void DrawMessageContextMenu(const ImGui::Private::TMessage& Message);
+	void UpdateSelection(int32 Index, const ImVec2& RowMin, const ImVec2& RowMax);
+	int32 FormatPrefix(const ImGui::Private::TMessage& Message, char* Out, int32 OutSize) const;
+	int32 GetPrefixSize(const ImGui::Private::TMessage& Message) const;
+
+	void AddNewCategories();
+	void ValidateMessages(double Deadline);
+	void ProcessPendingMessages(double Deadline);
+	void RestoreScrollAnchor();
+	int32 FindDisplayedLine(uint64 Sequence, int32 LineIndex) const;
+	void AddFrameStart(const ImGui::Private::TMessage& Message, int32 Line);
+	int32 FindFrameLine(uint64 Frame) const;
+	void ScrollToLine(int32 Line);
+	void FindSearchCandidates();
+	void SkipToMessage(int32 Index);
+	int32 GetBaseLine() const;
+	int32 GetDisplayedLine(int32 Index) const;
+	bool HasSelection() const;
+	bool IsSelected(int32 Index) const;
+	void GetSelectedRange(int32& OutBegin, int32& OutEnd) const;
+	void SelectAll();
+	void CopySelection() const;
 	void Clear();
+	void ResetView(int32 InBaseMessage);
 
-	void TryFilteringMessage(int32 Index);
-	void FilterAllMessages();
+	void TryFilteringMessage(const ImGui::Private::TMessageRef& Message, int32 Index);
+	void StartExport();
+	void OpenLogFile();
+	void AttachSharedLog();
+	void SetSource(TSharedPtr<FImGuiOutputLogFileSource> InFileSource,
+		TSharedPtr<FImGuiOutputLogSharedRingReader> InSharedSource = nullptr);
+	void SetRange(const FImGuiOutputLogFilter::FRange& Range);
+	SIZE_T GetAllocatedSize() const;
 
-	int32 MessageToLine(int32 MessageIndex) const;
 	static ImU32 VerbosityToColor(EImGuiLogVerbosity Verbosity);
-	static const char* VerbosityToString(EImGuiLogVerbosity Verbosity);
 
 public:
-	bool IsActive() const;
-	void SetActiveState(bool bInIsActive);
 	void SetDisplayedElements(int32 Elements);
 	void AddDisplayedElements(int32 Elements);
 	void RemovedDisplayedElements(int32 Elements);
 	EImGuiOutputLogMessageElement GetDisplayedElements() const;
 
-	FImGuiModule& GetImGuiModule() const;
-
 public:
-	UImGuiOutputLogBuffer* LogBuffer = nullptr;
+	FImGuiEngineLogImpl& Owner;
+	char WindowName[160];
+	bool bIsOpen = true;
+
+	TSharedPtr<FImGuiOutputLogStore> Store;
 
-	bool bIsActive = false;
 	uint8 ActiveElements = EImGuiOutputLogMessageElement::Category;
 	bool bElementsDirty = true;
 	bool bFiltersDirty = true;
 
-	TArray<ImGui::Private::TMessageRef> Messages;
-	TArray<TPair<ImGui::Private::TMessageRef, int32>> MultiLineMessages;
+	// Lines of the store that passed the filter
 	TArray<int32> FilteredToNormal;
 	int32 LinesOfText = 0;
 	FImGuiOutputLogFilter Filter;
-	int32 LastOutputLogIndex = INDEX_NONE;
+
+	// Categories of the store the filter already knows about
+	int32 KnownCategoriesNum = 0;
+
+	// First message of the store the view shows; clearing the view moves it past everything there is so far
+	int32 BaseMessage = 0;
+
+	// Messages before SearchCandidatesEnd that aren't listed here can't pass the text search
+	bool bUseSearchCandidates = false;
+	TArray<int32> SearchCandidates;
+	int32 SearchCandidatesEnd = 0;
+	int32 NextSearchCandidate = 0;
+
+	// Messages of the store before these have gone through the filter
+	int32 ProcessedMessagesNum = 0;
+	int32 ProcessedLinesNum = 0;
+
+	// Time spent going through the store again since the filter last changed
+	bool bIsRefiltering = false;
+	uint64 RefilterCycles = 0;
+
+	bool bFollowTail = true;
+	float LastScrollY = 0.f;
+
+	// Covers the displayed lines, so it's refilled along with them
+	FImGuiOutputLogMinimap Minimap;
+	int32 FirstVisibleLine = 0;
+	int32 VisibleLinesNum = 0;
+	int32 PendingScrollLine = INDEX_NONE;
+
+	// Displayed line each frame that has any starts at; frames only go up, so a frame is found by binary search
+	struct FFrameStart
+	{
+	public:
+		uint64 Frame = 0;
+		int32 Line = 0;
+		int32 MessagesNum = 0;
+	};
+
+	TArray<FFrameStart> FrameStarts;
+	bool bShowFrameSeparators = false;
+	char GoToFrame[24];
+
+	// Message and line at the top of the view; when the filter changes, the view goes back to it, or to the displayed
+	// line nearest to it if it's filtered out
+	uint64 ScrollAnchorSequence = 0;
+	int32 ScrollAnchorLineIndex = INDEX_NONE;
+	bool bRestoreScrollAnchor = false;
+
+	// Lines of the store between the one the selection started at and the one it ended at, both inclusive, so that it
+	// stays on the same lines whatever is added or filtered out
+	int32 SelectionAnchor = INDEX_NONE;
+	int32 SelectionEnd = INDEX_NONE;
+	bool bIsSelecting = false;
+
+	// Covers the displayed lines as well; while it's being redone for a new width, the view stays on the anchor
+	bool bWrapLines = false;
+	FImGuiOutputLogWrapLayout WrapLayout;
+	int32 WrapAnchorLine = INDEX_NONE;
+
+	FImGuiOutputLogExporter Exporter;
+	EImGuiOutputLogExportFormat ExportFormat = EImGuiOutputLogExportFormat::PlainText;
+	bool bExportFullLog = false;
+	char ExportFilename[512];
+
+	char RangeFromTime[32];
+	char RangeToTime[32];
+	char RangeFromFrame[24];
+	char RangeToFrame[24];
+
+	// When set, the log file is displayed instead of the live log, from a store of its own
+	TSharedPtr<FImGuiOutputLogFileSource> FileSource;
+	TSharedPtr<FImGuiOutputLogFileSource> LoadingFileSource;
+	UE::Tasks::TTask<bool> FileLoadingTask;
+	double FileOpenTime = 0.0;
+	char LogFilename[512];
+
+	// When set, the log of another process is tailed instead, from a store of its own as well
+	TSharedPtr<FImGuiOutputLogSharedRingReader> SharedSource;
+	char SharedLogName[128];
 };
 
-FImGuiEngineLogImpl::FImGuiEngineLogImpl()
+class FImGuiEngineLogImpl
 {
-	Filter.Context.Hint = "Search Log";
-	Filter.Context.Width = 200.f;
+public:
+	explicit FImGuiEngineLogImpl(UImGuiOutputLogBuffer* InLogBuffer);
+	~FImGuiEngineLogImpl();
+
+	bool Tick();
+	void TickHidden();
+	void WaitForBackgroundIndexing();
+
+	void AddView(const char* Title, const char* Query);
+	FImGuiEngineLogView& GetMainView() const;
+
+public:
+	bool IsActive() const;
+	void SetActiveState(bool bInIsActive);
+
+	FImGuiModule& GetImGuiModule() const;
+
+public:
+	UImGuiOutputLogBuffer* LogBuffer = nullptr;
+
+	bool bIsActive = false;
+
+	// PIE instance of the game instance the log belongs to, INDEX_NONE outside of PIE
+	int32 PlayInEditorId = INDEX_NONE;
+
+	// Messages of the live log, owned by the buffer and added once no matter how many views and clients show them
+	TSharedPtr<FImGuiOutputLogStore> LiveStore;
+
+	// The first one is the main window, which takes the others along when it's closed
+	TArray<TUniquePtr<FImGuiEngineLogView>> Views;
+	int32 NextViewId = 1;
+
+	// While hidden, new messages are filtered by this task; nothing else may touch the views until it's done, and the
+	// live store isn't added to until the tasks of all clients are
+	UE::Tasks::FTask BackgroundIndexingTask;
+	std::atomic<uint64> BackgroundIndexingCycles = 0;
+
+	// What being hidden still costs the frame: adding to the live store, and handing the rest over to the task
+	uint64 HiddenGameThreadCycles = 0;
+};
+
+FImGuiEngineLogImpl::FImGuiEngineLogImpl(UImGuiOutputLogBuffer* InLogBuffer)
+	: LogBuffer(InLogBuffer)
+	, LiveStore(InLogBuffer->GetLiveStore())
+{
+	Views.Add(MakeUnique<FImGuiEngineLogView>(*this, 0, nullptr));
+}
+
+FImGuiEngineLogImpl::~FImGuiEngineLogImpl()
+{
+	WaitForBackgroundIndexing();
 }
 
 bool FImGuiEngineLogImpl::Tick()
 {
-	ImGui::SetNextWindowSize(ImVec2(800, 400), ImGuiCond_FirstUseEver);
-	ImGui::Begin("Engine Log", &bIsActive);
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
 
-	if (!bIsActive)
+	// Whatever doesn't fit in the budget is carried over to the next frame
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	const double Deadline = FPlatformTime::Seconds() + Settings->IngestionBudgetMs / 1000.0;
+
+	LogBuffer->UpdateLiveStore(Deadline);
+
+	// Views may be added while ticking, and removed once closed
+	for (int32 i = 0; i < Views.Num(); ++i)
 	{
-		SetActiveState(false);
-		ImGui::End();
-		return false;
+		if (Views[i]->Tick(Deadline))
+		{
+			if (!LogBuffer->IsDetached())
+			{
+				INC_DWORD_STAT_BY(STAT_ImGuiOutputLog_FilteredLines, Views[i]->LinesOfText);
+			}
+
+			continue;
+		}
+
+		if (i == 0)
+		{
+			SetActiveState(false);
+			return false;
+		}
+
+		Views.RemoveAt(i--);
 	}
 
-	ImGui::SameLine();
-	if (Filter.Draw())
+	return true;
+}
+
+void FImGuiEngineLogImpl::TickHidden()
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	if (!BackgroundIndexingTask.IsCompleted())
 	{
-		bFiltersDirty = true;
+		// Still busy with the previous batch; the new messages will be picked up next time
+		return;
 	}
 
-	if (bFiltersDirty)
+	const uint64 GameThreadStartCycles = FPlatformTime::Cycles64();
+
+	// Splitting the messages into lines is cheap and shared by all clients, so only the filtering is left to the worker
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	LogBuffer->UpdateLiveStore(FPlatformTime::Seconds() + Settings->IngestionBudgetMs / 1000.0);
+
+	const bool bNeedsIndexing = Views.ContainsByPredicate([](const TUniquePtr<FImGuiEngineLogView>& View)
+	{
+		return View->NeedsIndexing();
+	});
+
+	if (!bNeedsIndexing)
 	{
-		FilteredToNormal.Empty();
-		LinesOfText = 0;
+		HiddenGameThreadCycles += FPlatformTime::Cycles64() - GameThreadStartCycles;
+		return;
 	}
 
-	ImGui::SameLine();
-	if (DrawVerbosities())
+	// The filter may read texts, so none of them may be moved to the cold tier meanwhile
+	FImGuiOutputLogColdStore::Get().AddReader();
+
+	BackgroundIndexingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
 	{
-		bElementsDirty = true;
+		LLM_SCOPE_BYTAG(ImGuiOutputLog);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		for (const auto& View : Views)
+		{
+			View->IndexInBackground();
+		}
+
+		BackgroundIndexingCycles += FPlatformTime::Cycles64() - StartCycles;
+		FImGuiOutputLogColdStore::Get().RemoveReader();
+	}, UE::Tasks::ETaskPriority::BackgroundLow);
+
+	LogBuffer->AddLiveStoreReader(BackgroundIndexingTask);
+	HiddenGameThreadCycles += FPlatformTime::Cycles64() - GameThreadStartCycles;
+}
+
+void FImGuiEngineLogImpl::WaitForBackgroundIndexing()
+{
+	BackgroundIndexingTask.Wait();
+}
+
+void FImGuiEngineLogImpl::AddView(const char* Title, const char* Query)
+{
+	FImGuiEngineLogView& View = *Views.Add_GetRef(MakeUnique<FImGuiEngineLogView>(*this, NextViewId++, Title));
+	View.Filter.SetQuery(Query);
+}
+
+FImGuiEngineLogView& FImGuiEngineLogImpl::GetMainView() const
+{
+	return *Views[0];
+}
+
+FImGuiOutputLogDetachedView::FImGuiOutputLogDetachedView(UImGuiOutputLogBuffer* LogBuffer)
+{
+	check(LogBuffer->IsDetached());
+
+	// Active without going through SetActiveState, which would take the input of the ImGui module
+	Impl = MakeUnique<FImGuiEngineLogImpl>(LogBuffer);
+	Impl->bIsActive = true;
+
+	ImGuiContext* PreviousContext = ImGui::GetCurrentContext();
+	Context = ImGui::CreateContext();
+	ImGui::SetCurrentContext(Context);
+
+	ImGuiIO& IO = ImGui::GetIO();
+	IO.DisplaySize = ImVec2(1920.f, 1080.f);
+	IO.DeltaTime = 1.f / 60.f;
+	IO.IniFilename = nullptr;
+
+	// Nothing is rendered, but the font has to be built to lay out text
+	unsigned char* Pixels;
+	int32 Width, Height;
+	IO.Fonts->GetTexDataAsRGBA32(&Pixels, &Width, &Height);
+
+	ImGui::SetCurrentContext(PreviousContext);
+}
+
+FImGuiOutputLogDetachedView::~FImGuiOutputLogDetachedView()
+{
+	Impl.Reset();
+	ImGui::DestroyContext(Context);
+}
+
+void FImGuiOutputLogDetachedView::Tick(int32 TopLine)
+{
+	FImGuiEngineLogView& View = Impl->GetMainView();
+	if (TopLine != INDEX_NONE)
+	{
+		View.ScrollToLine(TopLine);
 	}
 
-	ImGui::SameLine();
-	if (ImGui::Button("Clear"))
+	// Whatever the game draws into its own context is left alone
+	ImGuiContext* PreviousContext = ImGui::GetCurrentContext();
+	ImGui::SetCurrentContext(Context);
+	ImGui::NewFrame();
+
+	// The window only takes its default size the first time; after that it's made to fill the display, as if maximized
+	ImGui::SetWindowPos(View.WindowName, ImVec2(0.f, 0.f));
+	ImGui::SetWindowSize(View.WindowName, ImGui::GetIO().DisplaySize);
+
+	Impl->Tick();
+
+	ImGui::Render();
+	ImGui::SetCurrentContext(PreviousContext);
+}
+
+void FImGuiOutputLogDetachedView::SetQuery(const char* Query)
+{
+	FImGuiEngineLogView& View = Impl->GetMainView();
+	View.Filter.SetQuery(Query);
+	View.bFiltersDirty = true;
+	View.ValidateMessages(TNumericLimits<double>::Max());
+}
+
+void FImGuiOutputLogDetachedView::SetDisplayedElements(int32 Elements)
+{
+	FImGuiEngineLogView& View = Impl->GetMainView();
+	View.SetDisplayedElements(Elements);
+	View.ValidateMessages(TNumericLimits<double>::Max());
+}
+
+void FImGuiOutputLogDetachedView::SetWrapLines(bool bWrapLines)
+{
+	// As the menu item does
+	FImGuiEngineLogView& View = Impl->GetMainView();
+	View.bWrapLines = bWrapLines;
+	View.WrapLayout.Reset();
+	View.PendingScrollLine = View.bFollowTail ? INDEX_NONE : View.FirstVisibleLine;
+}
+
+void FImGuiOutputLogDetachedView::SelectAll()
+{
+	Impl->GetMainView().SelectAll();
+}
+
+int32 FImGuiOutputLogDetachedView::GetLinesNum() const
+{
+	return Impl->GetMainView().LinesOfText;
+}
+
+int64 FImGuiOutputLogDetachedView::FormatAllPrefixes() const
+{
+	const FImGuiEngineLogView& View = Impl->GetMainView();
+
+	int64 Bytes = 0;
+	char Prefix[256];
+	for (int32 i = 0; i < View.Store->GetMessagesNum(); ++i)
 	{
-		Clear();
+		Bytes += View.FormatPrefix(*View.Store->GetStoredMessage(i), Prefix, IM_ARRAYSIZE(Prefix));
 	}
 
-	ImGui::Separator();
+	return Bytes;
+}
 
-	AddNewMessages();
-	ValidateMessages();
+bool FImGuiOutputLogDetachedView::OpenFile(const FString& Filename, double& OutParseTime)
+{
+	FImGuiEngineLogView& View = Impl->GetMainView();
+	ImStrncpy(View.LogFilename, TCHAR_TO_UTF8(*Filename), IM_ARRAYSIZE(View.LogFilename));
+	View.OpenLogFile();
 
-	DrawAllMessages();
+	View.FileLoadingTask.Wait();
+	OutParseTime = View.LoadingFileSource->GetParseTime();
 
-	ImGui::End();
+	// The file is picked up on the next frame, and the time is logged once its first screen is drawn, or it failed
+	while (View.FileOpenTime > 0.0)
+	{
+		Tick();
+	}
 
-	return true;
+	return View.FileSource.IsValid();
 }
 
 UImGuiEngineOutputLog::~UImGuiEngineOutputLog()
@@ -165,8 +529,14 @@ void UImGuiEngineOutputLog::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	Impl = new FImGuiEngineLogImpl;
-	Impl->LogBuffer = Cast<UImGuiOutputLogBuffer>(Collection.InitializeDependency(UImGuiOutputLogBuffer::StaticClass()));
+	// The messages are captured and split into lines once for the whole engine, however many clients there are in PIE
+	UImGuiOutputLogBuffer* LogBuffer = GEngine->GetEngineSubsystem<UImGuiOutputLogBuffer>();
+	check(LogBuffer);
+	Impl = new FImGuiEngineLogImpl(LogBuffer);
+
+	const FWorldContext* WorldContext = GetGameInstance()->GetWorldContext();
+	Impl->PlayInEditorId = WorldContext ? WorldContext->PIEInstance : INDEX_NONE;
+	Impl->GetMainView().Filter.Context.PlayInEditorId = Impl->PlayInEditorId;
 }
 
 void UImGuiEngineOutputLog::Deinitialize()
@@ -185,6 +555,12 @@ void UImGuiEngineOutputLog::Tick(float DeltaSeconds)
 
 	LastFrameNumberWeTicked = GFrameCounter;
 
+	if (!Impl->IsActive())
+	{
+		Impl->TickHidden();
+		return;
+	}
+
 	if (!Impl->Tick())
 	{
 		OnClosedDelegate.Broadcast();
@@ -203,7 +579,13 @@ TStatId UImGuiEngineOutputLog::GetStatId() const
 
 bool UImGuiEngineOutputLog::IsTickable() const
 {
-	return Impl && Impl->bIsActive;
+	if (!Impl)
+	{
+		return false;
+	}
+
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	return Impl->bIsActive || Settings->bIndexWhileHidden;
 }
 
 bool UImGuiEngineOutputLog::IsTickableWhenPaused() const
@@ -228,22 +610,61 @@ bool UImGuiEngineOutputLog::IsActive() const
 
 void UImGuiEngineOutputLog::SetDisplayedElements(int32 Elements)
 {
-	Impl->SetDisplayedElements(Elements);
+	Impl->WaitForBackgroundIndexing();
+	Impl->GetMainView().SetDisplayedElements(Elements);
 }
 
 void UImGuiEngineOutputLog::AddDisplayedElements(int32 Elements)
 {
-	Impl->AddDisplayedElements(Elements);
+	Impl->WaitForBackgroundIndexing();
+	Impl->GetMainView().AddDisplayedElements(Elements);
 }
 
 void UImGuiEngineOutputLog::RemovedDisplayedElements(int32 Elements)
 {
-	Impl->RemovedDisplayedElements(Elements);
+	Impl->WaitForBackgroundIndexing();
+	Impl->GetMainView().RemovedDisplayedElements(Elements);
 }
 
 TEnumAsByte<EImGuiOutputLogMessageElement> UImGuiEngineOutputLog::GetDisplayedElements() const
 {
-	return Impl->GetDisplayedElements();
+	return Impl->GetMainView().GetDisplayedElements();
+}
+
+void UImGuiEngineOutputLog::SetTimeRange(FDateTime From, FDateTime To)
+{
+	Impl->WaitForBackgroundIndexing();
+
+	FImGuiOutputLogFilter::FRange Range;
+	Range.MinTicks = From.GetTicks();
+	Range.MaxTicks = To.GetTicks();
+	Impl->GetMainView().SetRange(Range);
+}
+
+void UImGuiEngineOutputLog::SetFrameRange(int64 From, int64 To)
+{
+	Impl->WaitForBackgroundIndexing();
+
+	FImGuiOutputLogFilter::FRange Range;
+	Range.MinFrame = FMath::Max<int64>(From, 0);
+	Range.MaxFrame = To < 0 ? MAX_uint64 : To;
+	Impl->GetMainView().SetRange(Range);
+}
+
+void UImGuiEngineOutputLog::ClearRange()
+{
+	Impl->WaitForBackgroundIndexing();
+	Impl->GetMainView().SetRange({});
+}
+
+float UImGuiEngineOutputLog::GetHiddenIndexingTime() const
+{
+	return FPlatformTime::ToSeconds64(Impl->BackgroundIndexingCycles);
+}
+
+float UImGuiEngineOutputLog::GetHiddenGameThreadTime() const
+{
+	return FPlatformTime::ToSeconds64(Impl->HiddenGameThreadCycles);
 }
 
 bool FImGuiEngineLogImpl::IsActive() const
@@ -253,6 +674,11 @@ bool FImGuiEngineLogImpl::IsActive() const
 
 void FImGuiEngineLogImpl::SetActiveState(bool bInIsActive)
 {
+	if (bInIsActive)
+	{
+		WaitForBackgroundIndexing();
+	}
+
 	bIsActive = bInIsActive;
 
 	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
@@ -262,343 +688,1710 @@ void FImGuiEngineLogImpl::SetActiveState(bool bInIsActive)
 	}
 }
 
-void FImGuiEngineLogImpl::SetDisplayedElements(int32 Elements)
+FImGuiModule& FImGuiEngineLogImpl::GetImGuiModule() const
 {
-	if (ActiveElements != Elements)
-	{
-		ActiveElements = Elements;
-		bElementsDirty = true;
-	}
+	return *static_cast<FImGuiModule*>(FModuleManager::Get().GetModule("ImGui"));
 }
 
-void FImGuiEngineLogImpl::AddDisplayedElements(int32 Elements)
+FImGuiEngineLogView::FImGuiEngineLogView(FImGuiEngineLogImpl& InOwner, int32 Id, const char* Title)
+	: Owner(InOwner)
+	, Store(InOwner.LiveStore)
 {
-	if (ActiveElements | Elements)
+	// The ID keeps the window where it was even if the title is the same as another one's
+	if (Title)
 	{
-		ActiveElements |= Elements;
-		bElementsDirty = true;
+		FCStringAnsi::Snprintf(WindowName, IM_ARRAYSIZE(WindowName), "Engine Log: %s###EngineLogView%d", Title, Id);
 	}
-}
-
-void FImGuiEngineLogImpl::RemovedDisplayedElements(int32 Elements)
-{
-	if (ActiveElements & ~Elements)
+	else
 	{
-		ActiveElements &= ~Elements;
-		bElementsDirty = true;
+		ImStrncpy(WindowName, "Engine Log", IM_ARRAYSIZE(WindowName));
 	}
-}
 
-EImGuiOutputLogMessageElement FImGuiEngineLogImpl::GetDisplayedElements() const
-{
-	return static_cast<EImGuiOutputLogMessageElement>(ActiveElements);
-}
+	Filter.Context.Hint = "Search Log";
+	Filter.Context.Width = 200.f;
+	Filter.Context.PlayInEditorId = Owner.PlayInEditorId;
 
-FImGuiModule& FImGuiEngineLogImpl::GetImGuiModule() const
-{
-	return *static_cast<FImGuiModule*>(FModuleManager::Get().GetModule("ImGui"));
+	const FString DefaultExportFilename = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectLogDir() / TEXT("ImGuiOutputLog.") + FImGuiOutputLogExporter::GetExtension(ExportFormat));
+	ImStrncpy(ExportFilename, TCHAR_TO_UTF8(*DefaultExportFilename), IM_ARRAYSIZE(ExportFilename));
+
+	const FString DefaultLogFilename = FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir());
+	ImStrncpy(LogFilename, TCHAR_TO_UTF8(*DefaultLogFilename), IM_ARRAYSIZE(LogFilename));
+	SharedLogName[0] = '\0';
+	GoToFrame[0] = '\0';
+
+	SetRange({});
 }
 
-void FImGuiEngineLogImpl::AddNewMessages()
+FImGuiEngineLogView::~FImGuiEngineLogView()
 {
-	const int32 Num = LogBuffer->Messages.Num();
-	for (int32 i = LastOutputLogIndex + 1; i < Num; ++i)
+	// The exported messages may point into the file of the view, which goes away before the exporter does
+	if (Exporter.IsRunning())
 	{
-		AddMessage(LogBuffer->Messages[i]);
+		Exporter.Cancel();
+		Exporter.Wait();
 	}
-
-	LastOutputLogIndex = Num - 1;
 }
 
-void FImGuiEngineLogImpl::AddMessage(const ImGui::Private::TMessageRef Message)
+bool FImGuiEngineLogView::Tick(double Deadline)
 {
-	const int32 Index = Messages.Num();
-	auto& Ref = Messages.Add_GetRef(Message);
+	ImGui::SetNextWindowSize(ImVec2(800, 400), ImGuiCond_FirstUseEver);
+	ImGui::Begin(WindowName, &bIsOpen);
 
-	const int32 Lines = Ref->LineOffsets.Num();
-	for (int32 i = 0; i < Lines; ++i)
+	if (!bIsOpen)
 	{
-		MultiLineMessages.Add({ Ref,i });
+		// Reopening the main window brings the view back as it was
+		bIsOpen = true;
+		ImGui::End();
+		return false;
 	}
 
-	if (!bElementsDirty)
+	ImGui::SameLine();
+	if (Filter.Draw())
 	{
-		FormatMessage(Ref);
-		if (Filter.IsActive())
-		{
-			TryFilteringMessage(MultiLineMessages.Num() - Lines);
-		}
-		else
-		{
-			LinesOfText += Lines;
-		}
+		bFiltersDirty = true;
 	}
 
-	bool bIsCategoryPresent = false;
-	for (const auto& [Category, _] : Filter.Context.Categories)
+	ImGui::SameLine();
+	if (DrawVerbosities())
 	{
-		if (ImStricmp(Category, Message->Category) == 0)
-		{
-			bIsCategoryPresent = true;
-			break;
-		}
+		bElementsDirty = true;
 	}
 
-	if (!bIsCategoryPresent)
-	{
-		Filter.Context.Categories.Add({ ImStrdup(Message->Category),Filter.Context.bShowAll });
-	}
-}
+	ImGui::SameLine();
+	DrawRange();
 
-bool FImGuiEngineLogImpl::DrawVerbosities()
-{
-	if (ImGui::Button("Verbosities"))
+	ImGui::SameLine();
+	if (ImGui::Button("Clear"))
 	{
-		ImGui::OpenPopup("VerbositiesPopup");
+		Clear();
 	}
 
-	bool bHasChanged = false;
-	if (ImGui::BeginPopup("VerbositiesPopup"))
-	{
-		ImGui::PushItemFlag(ImGuiItemFlags_AutoClosePopups, false);
+	ImGui::SameLine();
+	DrawExport();
 
-		ImGui::SeparatorText("Verbosities");
+	ImGui::SameLine();
+	DrawLogFile();
 
-		bool bShowCategory = ActiveElements & Category;
-		bHasChanged |= ImGui::MenuItem("Category", "", &bShowCategory);
-		ActiveElements = bShowCategory ? ActiveElements | Category : ActiveElements & ~Category;
+	ImGui::SameLine();
+	DrawNewView();
 
-		bool bShowVerbosity = ActiveElements & Verbosity;
-		bHasChanged |= ImGui::MenuItem("Verbosity", "", &bShowVerbosity);
-		ActiveElements = bShowVerbosity ? ActiveElements | Verbosity : ActiveElements & ~Verbosity;
+	ImGui::SameLine();
+	DrawStats();
 
-		bool bShowTimestamp = ActiveElements & Timestamp;
-		bHasChanged |= ImGui::MenuItem("Timestamp", "", &bShowTimestamp);
-		ActiveElements = bShowTimestamp ? ActiveElements | Timestamp : ActiveElements & ~Timestamp;
+	ImGui::SameLine();
+	DrawFrames();
 
-		ImGui::PopItemFlag();
-		ImGui::EndPopup();
-	}
+	ImGui::SameLine();
+	DrawHitches();
+
+	const int32 PendingMessagesNum = GetPendingMessagesNum();
+	if (PendingMessagesNum > 0)
+	{
+		ImGui::SameLine();
+		ImGui::TextDisabled("Catching up... (%d left)", PendingMessagesNum);
+	}
+
+	ImGui::Separator();
+
+	if (SharedSource)
+	{
+		SharedSource->Poll(Deadline);
+	}
+
+	// The live store is fed by the owner, as it's shared, and the store of a file has all of it from the start
+	if (SharedSource)
+	{
+		Store->AddNewMessages(SharedSource->Messages, Deadline);
+	}
+
+	ValidateMessages(Deadline);
+
+	DrawAllMessages();
+
+	if (FileOpenTime > 0.0 && FileSource && (ProcessedMessagesNum > 0 || GetPendingMessagesNum() == 0))
+	{
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		UE_LOG(LogImGuiOutputLog, Display,
+			TEXT("Opened %s (%.1f MB, %d messages): parsed in %.3f s, first screen after %.3f s, peak RSS %.1f MB"),
+			*FileSource->GetFilename(), FileSource->GetFileSize() / (1024.0 * 1024.0), FileSource->GetMessagesNum(),
+			FileSource->GetParseTime(), FPlatformTime::Seconds() - FileOpenTime,
+			MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+
+		FileOpenTime = 0.0;
+	}
+
+	ImGui::End();
+
+	return true;
+}
+
+bool FImGuiEngineLogView::NeedsIndexing() const
+{
+	if (bElementsDirty || bFiltersDirty || ProcessedMessagesNum < Store->GetMessagesNum())
+	{
+		return true;
+	}
+
+	return SharedSource && (SharedSource->HasNewMessages() || Store->GetMessagesNum() < SharedSource->Messages.Num());
+}
+
+void FImGuiEngineLogView::IndexInBackground()
+{
+	// Nobody is waiting for the result, so there's no need to budget anything here
+	if (SharedSource)
+	{
+		SharedSource->Poll(TNumericLimits<double>::Max());
+		Store->AddNewMessages(SharedSource->Messages, TNumericLimits<double>::Max());
+	}
+
+	ValidateMessages(TNumericLimits<double>::Max());
+}
+
+void FImGuiEngineLogView::SetDisplayedElements(int32 Elements)
+{
+	if (ActiveElements != Elements)
+	{
+		ActiveElements = Elements;
+		bElementsDirty = true;
+	}
+}
+
+void FImGuiEngineLogView::AddDisplayedElements(int32 Elements)
+{
+	if (ActiveElements | Elements)
+	{
+		ActiveElements |= Elements;
+		bElementsDirty = true;
+	}
+}
+
+void FImGuiEngineLogView::RemovedDisplayedElements(int32 Elements)
+{
+	if (ActiveElements & ~Elements)
+	{
+		ActiveElements &= ~Elements;
+		bElementsDirty = true;
+	}
+}
+
+EImGuiOutputLogMessageElement FImGuiEngineLogView::GetDisplayedElements() const
+{
+	return static_cast<EImGuiOutputLogMessageElement>(ActiveElements);
+}
+
+void FImGuiEngineLogView::AddNewCategories()
+{
+	const TArray<const char*>& Categories = Store->Categories;
+	for (; KnownCategoriesNum < Categories.Num(); ++KnownCategoriesNum)
+	{
+		Filter.Context.Categories.Add({ ImStrdup(Categories[KnownCategoriesNum]),Filter.Context.bShowAll });
+	}
+}
+
+int32 FImGuiEngineLogView::GetPendingMessagesNum() const
+{
+	const int32 NotAddedNum = GetSourceMessagesNum() - Store->GetMessagesNum();
+	const int32 NotProcessedNum = FMath::Max(0, Store->GetMessagesNum() - ProcessedMessagesNum);
+	return NotAddedNum + NotProcessedNum;
+}
+
+int32 FImGuiEngineLogView::GetSourceMessagesNum() const
+{
+	return FileSource ? FileSource->GetMessagesNum() : GetSourceMessages().Num();
+}
+
+const TArray<ImGui::Private::TMessageRef>& FImGuiEngineLogView::GetSourceMessages() const
+{
+	// Files have no message objects, only columns
+	check(!FileSource);
+
+	return SharedSource ? SharedSource->Messages : Owner.LogBuffer->Messages;
+}
+
+bool FImGuiEngineLogView::DrawVerbosities()
+{
+	if (ImGui::Button("Verbosities"))
+	{
+		ImGui::OpenPopup("VerbositiesPopup");
+	}
+
+	bool bHasChanged = false;
+	if (ImGui::BeginPopup("VerbositiesPopup"))
+	{
+		ImGui::PushItemFlag(ImGuiItemFlags_AutoClosePopups, false);
+
+		ImGui::SeparatorText("Verbosities");
+
+		bool bShowCategory = ActiveElements & Category;
+		bHasChanged |= ImGui::MenuItem("Category", "", &bShowCategory);
+		ActiveElements = bShowCategory ? ActiveElements | Category : ActiveElements & ~Category;
+
+		bool bShowVerbosity = ActiveElements & Verbosity;
+		bHasChanged |= ImGui::MenuItem("Verbosity", "", &bShowVerbosity);
+		ActiveElements = bShowVerbosity ? ActiveElements | Verbosity : ActiveElements & ~Verbosity;
+
+		bool bShowThread = ActiveElements & Thread;
+		bHasChanged |= ImGui::MenuItem("Thread", "", &bShowThread);
+		ActiveElements = bShowThread ? ActiveElements | Thread : ActiveElements & ~Thread;
+
+		bool bShowTimestamp = ActiveElements & Timestamp;
+		bHasChanged |= ImGui::MenuItem("Timestamp", "", &bShowTimestamp);
+		ActiveElements = bShowTimestamp ? ActiveElements | Timestamp : ActiveElements & ~Timestamp;
+
+		ImGui::SeparatorText("Layout");
+
+		if (ImGui::MenuItem("Wrap Lines", "", &bWrapLines))
+		{
+			// The rows change, but the line at the top doesn't
+			WrapLayout.Reset();
+			PendingScrollLine = bFollowTail ? INDEX_NONE : FirstVisibleLine;
+		}
+
+		ImGui::MenuItem("Frame Separators", "", &bShowFrameSeparators);
+
+		ImGui::PopItemFlag();
+		ImGui::EndPopup();
+	}
+
+	return bHasChanged;
+}
+
+void FImGuiEngineLogView::DrawRange()
+{
+	if (ImGui::Button(Filter.Context.Range.IsSet() ? "Range (Set)" : "Range"))
+	{
+		ImGui::OpenPopup("RangePopup");
+	}
+
+	if (!ImGui::BeginPopup("RangePopup"))
+	{
+		return;
+	}
+
+	ImGui::SeparatorText("Time");
+	ImGui::InputTextWithHint("From##Time", "2025.06.01-12.34.56", RangeFromTime, IM_ARRAYSIZE(RangeFromTime));
+	ImGui::InputTextWithHint("To##Time", "2025.06.01-12.34.56", RangeToTime, IM_ARRAYSIZE(RangeToTime));
+
+	ImGui::SeparatorText("Frames");
+	ImGui::InputTextWithHint("From##Frame", "First", RangeFromFrame, IM_ARRAYSIZE(RangeFromFrame),
+		ImGuiInputTextFlags_CharsDecimal);
+	ImGui::InputTextWithHint("To##Frame", "Last", RangeToFrame, IM_ARRAYSIZE(RangeToFrame),
+		ImGuiInputTextFlags_CharsDecimal);
+
+	if (ImGui::Button("Apply"))
+	{
+		// Whatever is empty or can't be parsed leaves its end of the range open
+		FImGuiOutputLogFilter::FRange Range;
+		FDateTime Time;
+		if (FDateTime::Parse(UTF8_TO_TCHAR(RangeFromTime), Time))
+		{
+			Range.MinTicks = Time.GetTicks();
+		}
+
+		if (FDateTime::Parse(UTF8_TO_TCHAR(RangeToTime), Time))
+		{
+			Range.MaxTicks = Time.GetTicks();
+		}
+
+		if (RangeFromFrame[0] != '\0')
+		{
+			Range.MinFrame = FCStringAnsi::Strtoui64(RangeFromFrame, nullptr, 10);
+		}
+
+		if (RangeToFrame[0] != '\0')
+		{
+			Range.MaxFrame = FCStringAnsi::Strtoui64(RangeToFrame, nullptr, 10);
+		}
+
+		SetRange(Range);
+		ImGui::CloseCurrentPopup();
+	}
+
+	ImGui::SameLine();
+	if (ImGui::Button("Clear"))
+	{
+		SetRange({});
+		ImGui::CloseCurrentPopup();
+	}
+
+	ImGui::EndPopup();
+}
+
+void FImGuiEngineLogView::DrawExport()
+{
+	if (Exporter.IsRunning())
+	{
+		ImGui::ProgressBar(Exporter.GetProgress(), ImVec2(120.f, 0.f));
+		ImGui::SameLine();
+		if (ImGui::Button("Cancel Export"))
+		{
+			Exporter.Cancel();
+		}
+
+		return;
+	}
+
+	if (ImGui::Button("Export..."))
+	{
+		ImGui::OpenPopup("ExportPopup");
+	}
+
+	if (ImGui::BeginPopup("ExportPopup"))
+	{
+		ImGui::SeparatorText("Export");
+
+		const char* FormatNames[] = { "Plain Text", "NDJSON", "CSV", "Capture" };
+		int32 FormatIndex = static_cast<int32>(ExportFormat);
+		if (ImGui::Combo("Format", &FormatIndex, FormatNames, IM_ARRAYSIZE(FormatNames)))
+		{
+			ExportFormat = static_cast<EImGuiOutputLogExportFormat>(FormatIndex);
+
+			const FString NewFilename = FPaths::ChangeExtension(UTF8_TO_TCHAR(ExportFilename),
+				FImGuiOutputLogExporter::GetExtension(ExportFormat));
+			ImStrncpy(ExportFilename, TCHAR_TO_UTF8(*NewFilename), IM_ARRAYSIZE(ExportFilename));
+		}
+
+		if (ImGui::RadioButton("Current View", !bExportFullLog))
+		{
+			bExportFullLog = false;
+		}
+
+		ImGui::SameLine();
+		if (ImGui::RadioButton("Full Log", bExportFullLog))
+		{
+			bExportFullLog = true;
+		}
+
+		ImGui::InputText("File", ExportFilename, IM_ARRAYSIZE(ExportFilename));
+
+		if (ImGui::Button("Export"))
+		{
+			StartExport();
+			ImGui::CloseCurrentPopup();
+		}
+
+		switch (Exporter.GetResult())
+		{
+		case FImGuiOutputLogExporter::EResult::Succeeded:
+			ImGui::TextDisabled("Exported to %s", TCHAR_TO_UTF8(*Exporter.GetFilename()));
+			break;
+		case FImGuiOutputLogExporter::EResult::Failed:
+			ImGui::TextDisabled("Failed to export to %s", TCHAR_TO_UTF8(*Exporter.GetFilename()));
+			break;
+		case FImGuiOutputLogExporter::EResult::Cancelled:
+			ImGui::TextDisabled("Export cancelled");
+			break;
+		default:
+			break;
+		}
+
+		ImGui::EndPopup();
+	}
+}
+
+void FImGuiEngineLogView::DrawLogFile()
+{
+	if (!FileLoadingTask.IsCompleted())
+	{
+		ImGui::TextDisabled("Loading %s...", TCHAR_TO_UTF8(*LoadingFileSource->GetFilename()));
+		return;
+	}
+
+	if (LoadingFileSource)
+	{
+		if (FileLoadingTask.GetResult())
+		{
+			SetSource(MoveTemp(LoadingFileSource));
+		}
+		else
+		{
+			UE_LOG(LogImGuiOutputLog, Warning, TEXT("Failed to open %s"), *LoadingFileSource->GetFilename());
+			FileOpenTime = 0.0;
+		}
+
+		LoadingFileSource.Reset();
+	}
+
+	if (FileSource)
+	{
+		if (ImGui::Button("Back to Live Log"))
+		{
+			SetSource(nullptr);
+			return;
+		}
+
+		ImGui::SameLine();
+		ImGui::TextDisabled("%s", TCHAR_TO_UTF8(*FPaths::GetCleanFilename(FileSource->GetFilename())));
+		return;
+	}
+
+	if (SharedSource)
+	{
+		if (ImGui::Button("Back to Live Log"))
+		{
+			SetSource(nullptr);
+			return;
+		}
+
+		ImGui::SameLine();
+		ImGui::TextDisabled("%s (%llu behind, %llu dropped)", TCHAR_TO_UTF8(*SharedSource->GetName()),
+			SharedSource->GetLagMessagesNum(), SharedSource->GetDroppedMessagesNum());
+		return;
+	}
+
+	if (ImGui::Button("Open Log File..."))
+	{
+		ImGui::OpenPopup("LogFilePopup");
+	}
+
+	if (ImGui::BeginPopup("LogFilePopup"))
+	{
+		ImGui::SeparatorText("Open Log File");
+		ImGui::InputText("File", LogFilename, IM_ARRAYSIZE(LogFilename));
+
+		if (ImGui::Button("Open"))
+		{
+			OpenLogFile();
+			ImGui::CloseCurrentPopup();
+		}
+
+		// Left behind by the crash log of the previous session
+		const FString PreviousSessionFilename = UImGuiOutputLogBuffer::GetPreviousCrashLogFilename();
+		if (IFileManager::Get().FileExists(*PreviousSessionFilename))
+		{
+			ImGui::SameLine();
+			if (ImGui::Button("Previous Session"))
+			{
+				ImStrncpy(LogFilename, TCHAR_TO_UTF8(*PreviousSessionFilename), IM_ARRAYSIZE(LogFilename));
+				OpenLogFile();
+				ImGui::CloseCurrentPopup();
+			}
+		}
+
+		ImGui::EndPopup();
+	}
+
+	ImGui::SameLine();
+	if (ImGui::Button("Attach..."))
+	{
+		ImGui::OpenPopup("SharedLogPopup");
+	}
+
+	if (ImGui::BeginPopup("SharedLogPopup"))
+	{
+		ImGui::SeparatorText("Attach to Shared Log");
+		ImGui::InputTextWithHint("Name", "Shared Log Name of the other process", SharedLogName,
+			IM_ARRAYSIZE(SharedLogName));
+
+		if (ImGui::Button("Attach"))
+		{
+			AttachSharedLog();
+			ImGui::CloseCurrentPopup();
+		}
+
+		ImGui::EndPopup();
+	}
+}
+
+void FImGuiEngineLogView::DrawNewView()
+{
+	if (ImGui::Button("New View"))
+	{
+		ImGui::OpenPopup("NewViewPopup");
+	}
+
+	if (!ImGui::BeginPopup("NewViewPopup"))
+	{
+		return;
+	}
+
+	// Every view opens on the live log, in a window of its own
+	ImGui::SeparatorText("New View");
+
+	if (ImGui::MenuItem("Everything"))
+	{
+		Owner.AddView("Everything", "");
+	}
+
+	if (ImGui::MenuItem("Warnings and Errors"))
+	{
+		Owner.AddView("Warnings and Errors", "lvl>=Warning");
+	}
+
+	if (ImGui::MenuItem("Errors Only"))
+	{
+		Owner.AddView("Errors", "lvl>=Error");
+	}
+
+	const char* Query = Filter.GetQuery();
+	if (ImGui::MenuItem("Same Search", nullptr, false, Query[0] != '\0'))
+	{
+		Owner.AddView(Query, Query);
+	}
+
+	ImGui::EndPopup();
+}
+
+void FImGuiEngineLogView::DrawStats()
+{
+	ImGui::TextDisabled("(?)");
+	if (!ImGui::BeginItemTooltip())
+	{
+		return;
+	}
+
+	const int32 BaseLine = GetBaseLine();
+	ImGui::Text("Messages: %d (%d lines)", FMath::Max(0, Store->GetMessagesNum() - BaseMessage),
+		FMath::Max(0, Store->GetLinesNum() - BaseLine));
+	ImGui::Text("Indexed while hidden: %.1f ms on workers, %.1f ms on the game thread",
+		FPlatformTime::ToMilliseconds64(Owner.BackgroundIndexingCycles),
+		FPlatformTime::ToMilliseconds64(Owner.HiddenGameThreadCycles));
+
+	ImGui::SeparatorText("Memory");
+	ImGui::Text("Messages: %.1f MB%s", Store->GetAllocatedSize() / (1024.0 * 1024.0),
+		Store == Owner.LiveStore ? ", shared by the live views of every client" : "");
+	ImGui::Text("This view: %.1f MB", GetAllocatedSize() / (1024.0 * 1024.0));
+
+	const FImGuiOutputLogColdStore::FStats ColdStats = FImGuiOutputLogColdStore::Get().GetStats();
+	if (ColdStats.ColdMessagesNum > 0)
+	{
+		// What a cold message still keeps in memory: itself, and its share of the compressed block
+		const double BytesPerMessage = sizeof(ImGui::Private::TMessage)
+			+ static_cast<double>(ColdStats.CompressedBytes) / ColdStats.ColdMessagesNum;
+
+		ImGui::SeparatorText("Cold Tier");
+		ImGui::Text("%lld messages in %lld blocks", ColdStats.ColdMessagesNum, ColdStats.ColdBlocksNum);
+		ImGui::Text("Texts: %.1f MB, compressed from %.1f MB", ColdStats.CompressedBytes / (1024.0 * 1024.0),
+			ColdStats.UncompressedBytes / (1024.0 * 1024.0));
+		ImGui::Text("Resident: ~%.1f MB per million messages", BytesPerMessage * 1000000.0 / (1024.0 * 1024.0));
+		ImGui::Text("Last decompression: %.3f ms (%lld so far)", ColdStats.LastDecompressionTime * 1000.0,
+			ColdStats.CacheMissesNum);
+	}
+
+	if (SharedSource)
+	{
+		ImGui::SeparatorText("Shared Log");
+		ImGui::Text("Behind by %llu messages (%.1f KB)", SharedSource->GetLagMessagesNum(),
+			SharedSource->GetLagBytes() / 1024.0);
+		ImGui::Text("Dropped: %llu messages", SharedSource->GetDroppedMessagesNum());
+	}
+
+	if (const FImGuiOutputLogTrigramIndex* SearchIndex = Owner.LogBuffer->GetSearchIndex())
+	{
+		ImGui::SeparatorText("Search Index");
+		ImGui::Text("%d messages indexed", SearchIndex->GetIndexedNum());
+		ImGui::Text("Memory: %.1f MB", SearchIndex->GetAllocatedSize() / (1024.0 * 1024.0));
+		if (bUseSearchCandidates)
+		{
+			ImGui::Text("Current search: %d candidates", SearchCandidates.Num());
+		}
+	}
+
+	ImGui::EndTooltip();
+}
+
+void FImGuiEngineLogView::DrawFrames()
+{
+	static constexpr int32 SparklineFramesNum = 100;
+
+	ImGui::SetNextItemWidth(100.f);
+	if (ImGui::InputTextWithHint("##GoToFrame", "Go to Frame", GoToFrame, IM_ARRAYSIZE(GoToFrame),
+		ImGuiInputTextFlags_CharsDecimal | ImGuiInputTextFlags_EnterReturnsTrue) && GoToFrame[0] != '\0')
+	{
+		ScrollToLine(FindFrameLine(FCStringAnsi::Strtoui64(GoToFrame, nullptr, 10)));
+	}
+
+	if (FrameStarts.IsEmpty())
+	{
+		return;
+	}
+
+	// Displayed messages of the last frames, including the ones that have none
+	const uint64 LastFrame = FrameStarts.Last().Frame;
+	float Counts[SparklineFramesNum] = {};
+	for (int32 i = FrameStarts.Num() - 1; i >= 0 && LastFrame - FrameStarts[i].Frame < SparklineFramesNum; --i)
+	{
+		Counts[SparklineFramesNum - 1 - (LastFrame - FrameStarts[i].Frame)] = FrameStarts[i].MessagesNum;
+	}
+
+	ImGui::SameLine();
+	ImGui::PlotHistogram("##Frames", Counts, SparklineFramesNum, 0, nullptr, 0.f, FLT_MAX,
+		ImVec2(100.f, ImGui::GetFrameHeight()));
+
+	if (ImGui::IsItemHovered())
+	{
+		const float Alpha = (ImGui::GetIO().MousePos.x - ImGui::GetItemRectMin().x) / ImGui::GetItemRectSize().x;
+		const int32 Bar = FMath::Clamp(static_cast<int32>(Alpha * SparklineFramesNum), 0, SparklineFramesNum - 1);
+		const uint64 Frame = LastFrame - (SparklineFramesNum - 1 - Bar);
+		ImGui::SetTooltip("Frame %llu: %d messages", static_cast<unsigned long long>(Frame),
+			static_cast<int32>(Counts[Bar]));
+
+		if (ImGui::IsItemClicked())
+		{
+			ScrollToLine(FindFrameLine(Frame));
+		}
+	}
+}
+
+void FImGuiEngineLogView::DrawHitches()
+{
+	// Frame times are only known for the frames of this process
+	if (FileSource || SharedSource)
+	{
+		return;
+	}
+
+	const TArray<FImGuiOutputLogFrameStats>& Hitches = Owner.LogBuffer->Hitches;
+	char Label[32];
+	FCStringAnsi::Snprintf(Label, sizeof(Label), "Hitches (%d)###Hitches", Hitches.Num());
+	if (ImGui::Button(Label))
+	{
+		ImGui::OpenPopup("HitchesPopup");
+	}
+
+	if (!ImGui::BeginPopup("HitchesPopup"))
+	{
+		return;
+	}
+
+	ImGui::TextDisabled("Frames over %.0f ms; click one to open a view of its messages",
+		GetDefault<UImGuiEngineOutputLogSettings>()->HitchThresholdMs);
+
+	static constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+		| ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit;
+
+	if (ImGui::BeginTable("HitchesTable", 5, TableFlags, ImVec2(0.f, 300.f)))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Frame");
+		ImGui::TableSetupColumn("Time");
+		ImGui::TableSetupColumn("Messages");
+		ImGui::TableSetupColumn("Lines");
+		ImGui::TableSetupColumn("Logged");
+		ImGui::TableHeadersRow();
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Hitches.Num());
+
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+			{
+				// The latest first
+				const FImGuiOutputLogFrameStats& Hitch = Hitches[Hitches.Num() - 1 - Row];
+				const unsigned long long Frame = Hitch.Frame;
+
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+
+				char FrameLabel[32];
+				FCStringAnsi::Snprintf(FrameLabel, sizeof(FrameLabel), "%llu", Frame);
+				if (ImGui::Selectable(FrameLabel, false, ImGuiSelectableFlags_SpanAllColumns))
+				{
+					char Title[64];
+					char Query[32];
+					FCStringAnsi::Snprintf(Title, sizeof(Title), "Frame %llu (%.1f ms)", Frame,
+						Hitch.DeltaTime * 1000.f);
+					FCStringAnsi::Snprintf(Query, sizeof(Query), "frame:%llu", Frame);
+					Owner.AddView(Title, Query);
+				}
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f ms", Hitch.DeltaTime * 1000.f);
+				ImGui::TableNextColumn();
+				ImGui::Text("%d", Hitch.MessagesNum);
+				ImGui::TableNextColumn();
+				ImGui::Text("%d", Hitch.LinesNum);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f KB", Hitch.Bytes / 1024.0);
+			}
+		}
+
+		ImGui::EndTable();
+	}
+
+	ImGui::EndPopup();
+}
+
+void FImGuiEngineLogView::DrawAllMessages()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiOutputLog_DrawMessages);
+
+	static constexpr float MinimapWidth = 12.f;
+	const ImVec2 AvailableSize = ImGui::GetContentRegionAvail();
+	const float LogWidth = AvailableSize.x - MinimapWidth - ImGui::GetStyle().ItemSpacing.x;
+
+	// Wrapped rows depend on the width, which mustn't change whenever the scrollbar shows up
+	const ImGuiWindowFlags WindowFlags = bWrapLines
+		? ImGuiWindowFlags_AlwaysVerticalScrollbar
+		: ImGuiWindowFlags_HorizontalScrollbar;
+
+	if (ImGui::BeginChild("scrolling", ImVec2(LogWidth, 0.f), ImGuiChildFlags_None, WindowFlags))
+	{
+		if (bWrapLines)
+		{
+			DrawWrappedMessages();
+		}
+		else if (Filter.IsActive())
+		{
+			ImGuiListClipper Clipper;
+			Clipper.Begin(LinesOfText);
+
+			while (Clipper.Step())
+			{
+				for (int32 Idx = Clipper.DisplayStart; Idx < Clipper.DisplayEnd; Idx++)
+				{
+					DrawFrameSeparator(Idx);
+					DrawMessage(FilteredToNormal[Idx]);
+				}
+			}
+
+			Clipper.End();
+		}
+		else
+		{
+			// Without a filter the view is a plain span of the store, so there's nothing to keep per line
+			const int32 BaseLine = GetBaseLine();
+
+			ImGuiListClipper Clipper;
+			Clipper.Begin(LinesOfText);
+
+			while (Clipper.Step())
+			{
+				for (int32 Idx = Clipper.DisplayStart; Idx < Clipper.DisplayEnd; Idx++)
+				{
+					DrawFrameSeparator(Idx);
+					DrawMessage(BaseLine + Idx);
+				}
+			}
+
+			Clipper.End();
+		}
+
+		// Keep up at the bottom of the scroll region if we were already at the bottom at the beginning of the frame.
+		// Using a scrollbar or mouse-wheel will take away from the bottom edge. While catching up the content grows
+		// every frame, so not being at the bottom doesn't mean much; only scrolling up does.
+		const float ScrollY = ImGui::GetScrollY();
+		const float ScrollMaxY = ImGui::GetScrollMaxY();
+		if (ScrollY >= ScrollMaxY && ScrollMaxY > 0.f)
+		{
+			bFollowTail = true;
+		}
+		else if (ScrollY < LastScrollY)
+		{
+			bFollowTail = false;
+		}
+
+		LastScrollY = ScrollY;
+
+		if (bFollowTail)
+		{
+			ImGui::SetScrollHereY(1.0f);
+		}
+
+		// Dragging the selection past the edges scrolls the log along
+		const float LineHeight = ImGui::GetTextLineHeightWithSpacing();
+		if (bIsSelecting)
+		{
+			const float MouseY = ImGui::GetIO().MousePos.y;
+			const float WindowTop = ImGui::GetWindowPos().y;
+			if (MouseY < WindowTop)
+			{
+				ImGui::SetScrollY(ScrollY - LineHeight);
+			}
+			else if (MouseY > WindowTop + ImGui::GetWindowHeight())
+			{
+				ImGui::SetScrollY(ScrollY + LineHeight);
+			}
+
+			bIsSelecting = ImGui::IsMouseDown(ImGuiMouseButton_Left);
+		}
+
+		if (ImGui::IsWindowFocused() && ImGui::GetIO().KeyCtrl)
+		{
+			if (ImGui::IsKeyPressed(ImGuiKey_C, false))
+			{
+				CopySelection();
+			}
+			else if (ImGui::IsKeyPressed(ImGuiKey_A, false))
+			{
+				SelectAll();
+			}
+		}
+
+		// The minimap works in lines, which are rows only when they aren't wrapped
+		const int32 FirstVisibleRow = ScrollY / LineHeight;
+		const int32 VisibleRowsNum = ImGui::GetWindowHeight() / LineHeight;
+		if (bWrapLines)
+		{
+			FirstVisibleLine = WrapLayout.FindLine(FirstVisibleRow);
+			VisibleLinesNum = WrapLayout.FindLine(FirstVisibleRow + VisibleRowsNum) - FirstVisibleLine + 1;
+		}
+		else
+		{
+			FirstVisibleLine = FirstVisibleRow;
+			VisibleLinesNum = VisibleRowsNum;
+		}
+
+		if (LinesOfText > 0 && !bRestoreScrollAnchor)
+		{
+			const int32 TopLine = GetDisplayedLine(FMath::Min(FirstVisibleLine, LinesOfText - 1));
+			const auto& [Message, LineIndex] = Store->GetLine(TopLine);
+			ScrollAnchorSequence = Message->Sequence;
+			ScrollAnchorLineIndex = LineIndex;
+		}
+
+		// Done last, so that following the tail doesn't override it
+		if (PendingScrollLine != INDEX_NONE)
+		{
+			const int32 Row = bWrapLines ? WrapLayout.GetFirstRow(PendingScrollLine) : PendingScrollLine;
+			ImGui::SetScrollY(Row * LineHeight);
+			PendingScrollLine = INDEX_NONE;
+			bFollowTail = false;
+		}
+	}
+
+	ImGui::EndChild();
+
+	ImGui::SameLine();
+	const int32 ClickedLine = Minimap.Draw(ImVec2(MinimapWidth, AvailableSize.y), FirstVisibleLine, VisibleLinesNum);
+	if (ClickedLine != INDEX_NONE)
+	{
+		// The clicked line ends up in the middle
+		PendingScrollLine = FMath::Max(0, ClickedLine - VisibleLinesNum / 2);
+	}
+}
+
+void FImGuiEngineLogView::DrawWrappedMessages()
+{
+	// The width is only known in here; when it changes, the rows are redone over the next frames
+	if (WrapLayout.Prepare(ImGui::GetContentRegionAvail().x) && !bFollowTail)
+	{
+		WrapAnchorLine = FirstVisibleLine;
+	}
+
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	const double Deadline = FPlatformTime::Seconds() + Settings->IngestionBudgetMs / 1000.0;
+	int32 LaidOutNum = 0;
+	while (WrapLayout.GetLaidOutNum() < LinesOfText)
+	{
+		const auto& [Message, LineIndex] = Store->GetLine(GetDisplayedLine(WrapLayout.GetLaidOutNum()));
+
+		float PrefixWidth = 0.f;
+		if (LineIndex == 0 && ActiveElements != EImGuiOutputLogMessageElement::None)
+		{
+			char Prefix[256];
+			const int32 PrefixLen = FormatPrefix(*Message, Prefix, sizeof(Prefix));
+			PrefixWidth = WrapLayout.GetTextWidth(Prefix, Prefix + PrefixLen);
+		}
+
+		const char* Begin;
+		const char* End;
+		const FImGuiOutputLogText Text = Message->GetText();
+		Message->GetLine(Text, LineIndex, Begin, End);
+		WrapLayout.Add(PrefixWidth, Begin, End);
+
+		if (IsPastDeadline(++LaidOutNum, Deadline))
+		{
+			break;
+		}
+	}
+
+	// Rows of the lines before the anchor settle as they're laid out, so it's kept in place until they all are
+	if (WrapAnchorLine != INDEX_NONE)
+	{
+		PendingScrollLine = WrapAnchorLine;
+		if (WrapLayout.GetLaidOutNum() > WrapAnchorLine)
+		{
+			WrapAnchorLine = INDEX_NONE;
+		}
+	}
+
+	ImGuiListClipper Clipper;
+	Clipper.Begin(WrapLayout.GetRowsNum(LinesOfText));
+
+	while (Clipper.Step())
+	{
+		int32 Line = WrapLayout.FindLine(Clipper.DisplayStart);
+		for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+		{
+			while (Line + 1 < LinesOfText && WrapLayout.GetFirstRow(Line + 1) <= Row)
+			{
+				Line++;
+			}
+
+			const int32 WrappedRow = Row - WrapLayout.GetFirstRow(Line);
+			if (WrappedRow == 0)
+			{
+				DrawFrameSeparator(Line);
+			}
+
+			DrawMessage(GetDisplayedLine(Line), WrappedRow);
+		}
+	}
+
+	Clipper.End();
+}
+
+void FImGuiEngineLogView::DrawFrameSeparator(int32 Line)
+{
+	if (!bShowFrameSeparators || Line == 0)
+	{
+		return;
+	}
+
+	const uint64 Frame = Store->GetLine(GetDisplayedLine(Line)).Key->Frame;
+	if (Frame == Store->GetLine(GetDisplayedLine(Line - 1)).Key->Frame)
+	{
+		return;
+	}
+
+	// Drawn over the top of the line rather than as a row of its own, so that lines and rows stay the same
+	const ImRect& ClipRect = ImGui::GetCurrentWindow()->InnerClipRect;
+	const float Y = ImGui::GetCursorScreenPos().y;
+	ImDrawList* DrawList = ImGui::GetWindowDrawList();
+	DrawList->AddLine(ImVec2(ClipRect.Min.x, Y), ImVec2(ClipRect.Max.x, Y), ImGui::GetColorU32(ImGuiCol_Separator));
+
+	char Label[32];
+	const int32 LabelLen = FCStringAnsi::Snprintf(Label, sizeof(Label), " Frame %llu ",
+		static_cast<unsigned long long>(Frame));
+	const ImVec2 LabelSize = ImGui::CalcTextSize(Label, Label + LabelLen);
+	const ImVec2 LabelMin(ClipRect.Max.x - LabelSize.x - ImGui::GetStyle().ItemSpacing.x, Y - LabelSize.y / 2.f);
+	const ImVec2 LabelMax(LabelMin.x + LabelSize.x, LabelMin.y + LabelSize.y);
+	DrawList->AddRectFilled(LabelMin, LabelMax, ImGui::GetColorU32(ImGuiCol_WindowBg));
+	DrawList->AddText(LabelMin, ImGui::GetColorU32(ImGuiCol_TextDisabled), Label, Label + LabelLen);
+}
+
+void FImGuiEngineLogView::DrawMessage(int32 Index, int32 WrappedRow)
+{
+	const auto& [Message, LineIndex] = Store->GetLine(Index);
+
+	// The whole visible width of the row can be clicked, not just the text, but not the scrollbar
+	const ImRect& ClipRect = ImGui::GetCurrentWindow()->InnerClipRect;
+	const float RowY = ImGui::GetCursorScreenPos().y;
+	const ImVec2 RowMin(ClipRect.Min.x, RowY);
+	const ImVec2 RowMax(ClipRect.Max.x, RowY + ImGui::GetTextLineHeightWithSpacing());
+	UpdateSelection(Index, RowMin, RowMax);
+
+	if (IsSelected(Index))
+	{
+		ImGui::GetWindowDrawList()->AddRectFilled(RowMin, RowMax, ImGui::GetColorU32(ImGuiCol_Header));
+	}
+
+	ImGui::PushStyleColor(ImGuiCol_Text, VerbosityToColor(Message->Verbosity));
+
+	// ImGui::TextUnformatted can't render multi-line texts correctly, so we render each line manually;
+	// this is why there's way more code compared to what it could've been
+
+	// The elements are only formatted for the visible lines, so that the text never has to be copied
+	char Prefix[256];
+	int32 PrefixLen = 0;
+	if (LineIndex == 0 && ActiveElements != EImGuiOutputLogMessageElement::None)
+	{
+		PrefixLen = FormatPrefix(*Message, Prefix, sizeof(Prefix));
+	}
+
+	const char* Begin;
+	const char* End;
+	const FImGuiOutputLogText Text = Message->GetText();
+	Message->GetLine(Text, LineIndex, Begin, End);
+
+	// Only the row asked for is drawn; the ones before it are walked through to find where it starts
+	if (WrappedRow != INDEX_NONE)
+	{
+		const char* RowEnd = WrapLayout.FindRowEnd(Begin, End, WrapLayout.GetTextWidth(Prefix, Prefix + PrefixLen));
+		for (int32 Row = 0; Row < WrappedRow && RowEnd < End; ++Row)
+		{
+			Begin = RowEnd;
+			RowEnd = WrapLayout.FindRowEnd(Begin, End, 0.f);
+		}
+
+		End = RowEnd;
+		PrefixLen = WrappedRow == 0 ? PrefixLen : 0;
+	}
+
+	if (PrefixLen > 0)
+	{
+		ImGui::TextUnformatted(Prefix, Prefix + PrefixLen);
+		ImGui::SameLine(0.f, 0.f);
+	}
+
+	ImGui::TextUnformatted(Begin, End);
+
+	ImGui::PopStyleColor();
+
+	ImGui::PushID(Index);
+	ImGui::PushID(WrappedRow);
+	DrawMessageContextMenu(*Message);
+	ImGui::PopID();
+	ImGui::PopID();
+}
+
+void FImGuiEngineLogView::DrawMessageContextMenu(const ImGui::Private::TMessage& Message)
+{
+	if (!ImGui::BeginPopupContextItem("MessageContextMenu"))
+	{
+		return;
+	}
+
+	if (ImGui::MenuItem("Show 5 s Around"))
+	{
+		const int64 HalfWindow = FTimespan::FromSeconds(2.5).GetTicks();
+
+		FImGuiOutputLogFilter::FRange Range;
+		Range.MinTicks = Message.Timestamp.GetTicks() - HalfWindow;
+		Range.MaxTicks = Message.Timestamp.GetTicks() + HalfWindow;
+		SetRange(Range);
+	}
+
+	if (ImGui::MenuItem("Show This Frame"))
+	{
+		FImGuiOutputLogFilter::FRange Range;
+		Range.MinFrame = Message.Frame;
+		Range.MaxFrame = Message.Frame;
+		SetRange(Range);
+	}
+
+	if (ImGui::MenuItem("Clear Range", nullptr, false, Filter.Context.Range.IsSet()))
+	{
+		SetRange({});
+	}
+
+	ImGui::Separator();
+
+	if (ImGui::MenuItem("Copy", "Ctrl+C", false, HasSelection()))
+	{
+		CopySelection();
+	}
+
+	if (ImGui::MenuItem("Select All", "Ctrl+A"))
+	{
+		SelectAll();
+	}
+
+	ImGui::EndPopup();
+}
+
+void FImGuiEngineLogView::UpdateSelection(int32 Index, const ImVec2& RowMin, const ImVec2& RowMax)
+{
+	if (!ImGui::IsWindowHovered() || !ImGui::IsMouseHoveringRect(RowMin, RowMax, false))
+	{
+		return;
+	}
+
+	if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+	{
+		// Shift extends the selection from where it started
+		if (!ImGui::GetIO().KeyShift || !HasSelection())
+		{
+			SelectionAnchor = Index;
+		}
+
+		SelectionEnd = Index;
+		bIsSelecting = true;
+	}
+	else if (bIsSelecting)
+	{
+		SelectionEnd = Index;
+	}
+}
+
+// Snprintf returns -1 once the output doesn't fit, so the length is clamped after every element; what doesn't fit is
+// dropped from the end, rather than the length going backwards
+static void AdvancePrefixLen(int32& Len, int32 Written, int32 OutSize)
+{
+	Len = Written < 0 ? OutSize - 1 : FMath::Min(Len + Written, OutSize - 1);
+}
 
-	return bHasChanged;
+template<typename FmtType, typename... ArgTypes>
+static void AppendPrefix(char* Out, int32 OutSize, int32& Len, const FmtType& Format, ArgTypes... Args)
+{
+	if (Len < OutSize - 1)
+	{
+		AdvancePrefixLen(Len, FCStringAnsi::Snprintf(Out + Len, OutSize - Len, Format, Args...), OutSize);
+	}
+}
+
+int32 FImGuiEngineLogView::FormatPrefix(const ImGui::Private::TMessage& Message, char* Out, int32 OutSize) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FImGuiEngineLogView::FormatPrefix);
+
+	// Timestamp Verbosity [Thread] Category Message
+	int32 Len = 0;
+	if (ActiveElements & Timestamp)
+	{
+		AdvancePrefixLen(Len, Message.FormatTimestamp(Out, OutSize), OutSize);
+		AppendPrefix(Out, OutSize, Len, " ");
+	}
+
+	if (ActiveElements & Verbosity)
+	{
+		AppendPrefix(Out, OutSize, Len, "%s ", ImGui::Private::TMessage::VerbosityToString(Message.Verbosity));
+	}
+
+	if ((ActiveElements & Thread) && Message.ThreadIndex != INDEX_NONE)
+	{
+		AppendPrefix(Out, OutSize, Len, "[%s] ", FImGuiOutputLogThreads::Get().GetName(Message.ThreadIndex));
+	}
+
+	if (ActiveElements & Category)
+	{
+		AppendPrefix(Out, OutSize, Len, "%.*s ", Message.CategoryLen, Message.Category);
+	}
+
+	return Len;
+}
+
+int32 FImGuiEngineLogView::GetPrefixSize(const ImGui::Private::TMessage& Message) const
+{
+	// The timestamp and the verbosity fit in this together; the thread name and the category have no bound
+	int32 Size = 64;
+	if ((ActiveElements & Thread) && Message.ThreadIndex != INDEX_NONE)
+	{
+		Size += FCStringAnsi::Strlen(FImGuiOutputLogThreads::Get().GetName(Message.ThreadIndex)) + 3;
+	}
+
+	if (ActiveElements & Category)
+	{
+		Size += Message.CategoryLen + 1;
+	}
+
+	return Size;
 }
 
-void FImGuiEngineLogImpl::DrawAllMessages()
+void FImGuiEngineLogView::ValidateMessages(double Deadline)
 {
-	if (ImGui::BeginChild("scrolling", ImVec2(0, 0.f), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiOutputLog_ValidateMessages);
+
+	AddNewCategories();
+
+	if (bElementsDirty)
+	{
+		// The text search goes through the displayed elements, so everything has to go through the filter again
+		Filter.Context.Elements = ActiveElements;
+		bFiltersDirty = true;
+		bElementsDirty = false;
+	}
+
+	if (bFiltersDirty)
+	{
+		bRestoreScrollAnchor = !bFollowTail && ScrollAnchorLineIndex != INDEX_NONE;
+		bIsRefiltering = true;
+		RefilterCycles = 0;
+		SkipToMessage(BaseMessage);
+		FilteredToNormal.Reset();
+		Minimap.Reset();
+		FrameStarts.Reset();
+		WrapLayout.Reset();
+		FindSearchCandidates();
+		bFiltersDirty = false;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ProcessPendingMessages(Deadline);
+
+	// Only the time spent on it counts, not the frames it was spread over
+	if (bIsRefiltering)
 	{
-		if (Filter.IsActive())
+		RefilterCycles += FPlatformTime::Cycles64() - StartCycles;
+		if (ProcessedMessagesNum >= Store->GetMessagesNum())
 		{
-			if (bFiltersDirty)
+			if (!Owner.LogBuffer->IsDetached())
 			{
-				FilterAllMessages();
+				SET_FLOAT_STAT(STAT_ImGuiOutputLog_RefilterTime, FPlatformTime::ToMilliseconds64(RefilterCycles));
 			}
 
-			ImGuiListClipper Clipper;
-			Clipper.Begin(LinesOfText);
+			bIsRefiltering = false;
+		}
+	}
 
-			while (Clipper.Step())
-			{
-				for (int32 Idx = Clipper.DisplayStart; Idx < Clipper.DisplayEnd; Idx++)
-				{
-					DrawMessage(FilteredToNormal[Idx]);
+	LinesOfText = Filter.IsActive() ? FilteredToNormal.Num() : FMath::Max(0, ProcessedLinesNum - GetBaseLine());
 
-				}
-			}
+	if (bRestoreScrollAnchor)
+	{
+		RestoreScrollAnchor();
+	}
+}
 
-			Clipper.End();
+void FImGuiEngineLogView::RestoreScrollAnchor()
+{
+	// Until the filter has gone past the anchor, the line nearest to it may still be to come
+	if (ProcessedMessagesNum < Store->GetMessagesNum()
+		&& Store->GetStoredMessage(ProcessedMessagesNum)->Sequence <= ScrollAnchorSequence)
+	{
+		return;
+	}
+
+	bRestoreScrollAnchor = false;
+
+	ScrollToLine(FindDisplayedLine(ScrollAnchorSequence, ScrollAnchorLineIndex));
+}
+
+void FImGuiEngineLogView::AddFrameStart(const ImGui::Private::TMessage& Message, int32 Line)
+{
+	if (FrameStarts.IsEmpty() || FrameStarts.Last().Frame != Message.Frame)
+	{
+		FrameStarts.Add({ Message.Frame, Line, 0 });
+	}
+
+	FrameStarts.Last().MessagesNum++;
+}
+
+int32 FImGuiEngineLogView::FindFrameLine(uint64 Frame) const
+{
+	if (FrameStarts.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	// Frames without displayed messages go to the next one that has any, or to the last one
+	const int32 Index = Algo::LowerBoundBy(FrameStarts, Frame, [](const FFrameStart& Start) { return Start.Frame; });
+	return FrameStarts[FMath::Min(Index, FrameStarts.Num() - 1)].Line;
+}
+
+void FImGuiEngineLogView::ScrollToLine(int32 Line)
+{
+	if (Line == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Wrapped rows are only known once laid out, so the view is held on the line until they are
+	PendingScrollLine = Line;
+	if (bWrapLines)
+	{
+		WrapAnchorLine = Line;
+	}
+}
+
+int32 FImGuiEngineLogView::FindDisplayedLine(uint64 Sequence, int32 LineIndex) const
+{
+	if (LinesOfText == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Messages are in the order they were logged, so if the one asked for is gone, the one after it takes its place
+	const int32 MessageIndex = Store->FindMessage(Sequence);
+
+	int32 Line = Store->GetFirstLine(MessageIndex);
+	if (MessageIndex < Store->GetMessagesNum() && Store->GetStoredMessage(MessageIndex)->Sequence == Sequence)
+	{
+		Line += FMath::Min(LineIndex, Store->GetFirstLine(MessageIndex + 1) - Line - 1);
+	}
+
+	if (!Filter.IsActive())
+	{
+		return FMath::Clamp(Line - GetBaseLine(), 0, LinesOfText - 1);
+	}
+
+	// The nearest of the lines that passed the filter on either side of it
+	const int32 Next = Algo::LowerBound(FilteredToNormal, Line);
+	if (Next == FilteredToNormal.Num())
+	{
+		return Next - 1;
+	}
+
+	if (Next > 0 && Line - FilteredToNormal[Next - 1] < FilteredToNormal[Next] - Line)
+	{
+		return Next - 1;
+	}
+
+	return Next;
+}
+
+void FImGuiEngineLogView::ProcessPendingMessages(double Deadline)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiOutputLog_FilterMessages);
+
+	const bool bIsFilterActive = Filter.IsActive();
+	const int32 Num = Store->GetMessagesNum();
+
+	// Only the messages in range are looked at; the ones before and after it are skipped in one go
+	int32 End = Num;
+	if (bIsFilterActive)
+	{
+		const FImGuiOutputLogFilter::FRange Range = Filter.GetRange();
+		if (Range.IsSet())
+		{
+			int32 Begin;
+			Store->FindSpan(Range, Begin, End);
+
+			if (ProcessedMessagesNum < Begin)
+			{
+				SkipToMessage(Begin);
+			}
 		}
-		else
+	}
+
+	while (ProcessedMessagesNum < End)
+	{
+		if (bUseSearchCandidates && ProcessedMessagesNum < SearchCandidatesEnd)
 		{
-			ImGuiListClipper Clipper;
-			Clipper.Begin(LinesOfText);
+			// Jump straight to the next message the index couldn't rule out
+			while (NextSearchCandidate < SearchCandidates.Num()
+				&& SearchCandidates[NextSearchCandidate] < ProcessedMessagesNum)
+			{
+				NextSearchCandidate++;
+			}
 
-			while (Clipper.Step())
+			const int32 NextCandidate = NextSearchCandidate < SearchCandidates.Num()
+				? SearchCandidates[NextSearchCandidate]
+				: SearchCandidatesEnd;
+
+			const int32 NextMessage = FMath::Min3(NextCandidate, SearchCandidatesEnd, End);
+			if (NextMessage > ProcessedMessagesNum)
 			{
-				for (int32 Idx = Clipper.DisplayStart; Idx < Clipper.DisplayEnd; Idx++)
-				{
-					DrawMessage(Idx);
-				}
+				SkipToMessage(NextMessage);
+				continue;
 			}
+		}
 
-			Clipper.End();
+		const auto& Message = Store->GetStoredMessage(ProcessedMessagesNum);
+		if (bIsFilterActive)
+		{
+			TryFilteringMessage(Message, ProcessedLinesNum);
+		}
+		else
+		{
+			Minimap.Add(Message->Verbosity, Message->GetLinesNum());
+			AddFrameStart(*Message, ProcessedLinesNum - GetBaseLine());
 		}
 
-		// Keep up at the bottom of the scroll region if we were already at the bottom at the beginning of the frame.
-		// Using a scrollbar or mouse-wheel will take away from the bottom edge.
-		if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+		ProcessedLinesNum += Message->GetLinesNum();
+		ProcessedMessagesNum++;
+
+		if (IsPastDeadline(ProcessedMessagesNum, Deadline))
 		{
-			ImGui::SetScrollHereY(1.0f);
+			break;
 		}
 	}
 
-	ImGui::EndChild();
+	// A cleared view may be waiting for messages that aren't in the store yet
+	if (ProcessedMessagesNum >= End)
+	{
+		SkipToMessage(FMath::Max(ProcessedMessagesNum, Num));
+	}
 }
 
-void FImGuiEngineLogImpl::DrawMessage(int32 Index) const
+void FImGuiEngineLogView::SkipToMessage(int32 Index)
 {
-	auto Message = MultiLineMessages[Index].Key;
-	const int32 OffsetIndex = MultiLineMessages[Index].Value;
-
-	ImGui::PushStyleColor(ImGuiCol_Text, VerbosityToColor(Message->Verbosity));
-
-	// ImGui::TextUnformatted can't render multi-line texts correctly, so we render each line manually;
-	// this is why there's way more code compared to what it could've been
+	ProcessedMessagesNum = Index;
+	ProcessedLinesNum = Store->GetFirstLine(Index);
+}
 
-	int32 Offset = OffsetIndex > 0 ? 1 : 0;
-	for (int32 i = 0; i < OffsetIndex; ++i)
-	{
-		Offset += Message->LineOffsets[i];
-	}
+int32 FImGuiEngineLogView::GetBaseLine() const
+{
+	return Store->GetFirstLine(BaseMessage);
+}
 
-	const int32 LineLength = Message->LineOffsets[OffsetIndex];
-	const char* Begin = Message->FormattedText + Offset;
-	const char* End = Message->FormattedText + Offset + LineLength - OffsetIndex;
-	ImGui::TextUnformatted(Begin, End);
+int32 FImGuiEngineLogView::GetDisplayedLine(int32 Index) const
+{
+	return Filter.IsActive() ? FilteredToNormal[Index] : GetBaseLine() + Index;
+}
 
-	ImGui::PopStyleColor();
+bool FImGuiEngineLogView::HasSelection() const
+{
+	return SelectionAnchor != INDEX_NONE;
 }
 
-void FImGuiEngineLogImpl::FormatMessage(ImGui::Private::TMessageRef Message) const
+bool FImGuiEngineLogView::IsSelected(int32 Index) const
 {
-	free(Message->FormattedText);
+	return HasSelection()
+		&& Index >= FMath::Min(SelectionAnchor, SelectionEnd)
+		&& Index <= FMath::Max(SelectionAnchor, SelectionEnd);
+}
 
-	// The format must NOT introduce any new newlines!
+void FImGuiEngineLogView::GetSelectedRange(int32& OutBegin, int32& OutEnd) const
+{
+	OutBegin = OutEnd = 0;
+	if (!HasSelection())
+	{
+		return;
+	}
 
-	// Timestamp Verbosity Category Message
-	char Fmt[16] = "";
-	const char* ToAppend[3] { "", "", "" };
-	int32 ToAllocate = Message->TextLen;
-	if (ActiveElements & Timestamp)
+	// Displayed lines are in the order of the store, so the selected ones are a span of them
+	const int32 First = FMath::Min(SelectionAnchor, SelectionEnd);
+	const int32 Last = FMath::Max(SelectionAnchor, SelectionEnd);
+	if (Filter.IsActive())
 	{
-		static const FString TimestampString = Message->Timestamp.ToString();
-		ToAppend[0] = TCHAR_TO_ANSI(*TimestampString);
-		ToAllocate += TimestampString.Len() + 1;
-		strcat_s(Fmt, "%s ");
+		OutBegin = Algo::LowerBound(FilteredToNormal, First);
+		OutEnd = Algo::UpperBound(FilteredToNormal, Last);
 	}
 	else
 	{
-		strcat_s(Fmt, "%s");
+		const int32 BaseLine = GetBaseLine();
+		OutBegin = FMath::Clamp(First - BaseLine, 0, LinesOfText);
+		OutEnd = FMath::Clamp(Last + 1 - BaseLine, OutBegin, LinesOfText);
 	}
+}
 
-	if (ActiveElements & Verbosity)
+void FImGuiEngineLogView::SelectAll()
+{
+	if (LinesOfText > 0)
 	{
-		ToAppend[1] = VerbosityToString(Message->Verbosity);
-		ToAllocate += ImStrlen(ToAppend[1]) + 1;
-		strcat_s(Fmt, "%s ");
+		SelectionAnchor = GetDisplayedLine(0);
+		SelectionEnd = GetDisplayedLine(LinesOfText - 1);
 	}
-	else
+}
+
+void FImGuiEngineLogView::CopySelection() const
+{
+	int32 Begin, End;
+	GetSelectedRange(Begin, End);
+	if (Begin >= End)
 	{
-		strcat_s(Fmt, "%s");
+		return;
 	}
 
-	if (ActiveElements & Category)
+	// Measured first, so that the whole selection is written into a single allocation
+	const bool bHasElements = ActiveElements != EImGuiOutputLogMessageElement::None;
+	int64 Size = 1;
+	for (int32 i = Begin; i < End; ++i)
 	{
-		ensure(ToAppend[2]);
-		ensure(Message->Category);
-		ToAppend[2] = Message->Category;
-		ensure(ToAppend[2]);
-		ToAllocate += Message->CategoryLen + 1;
-		strcat_s(Fmt, "%s ");
+		const auto& [Message, LineIndex] = Store->GetLine(GetDisplayedLine(i));
+		const int32 LineBegin = LineIndex > 0 ? Message->LineBreaks[LineIndex - 1] + 1 : 0;
+		const int32 LineEnd = LineIndex < Message->LineBreaks.Num() ? Message->LineBreaks[LineIndex] : Message->TextLen;
+		Size += LineEnd - LineBegin + 1 + (LineIndex == 0 && bHasElements ? GetPrefixSize(*Message) : 0);
 	}
-	else
+
+	TArray<char> Buffer;
+	Buffer.SetNumUninitialized(Size);
+	char* Out = Buffer.GetData();
+	for (int32 i = Begin; i < End; ++i)
 	{
-		strcat_s(Fmt, "%s");
+		const auto& [Message, LineIndex] = Store->GetLine(GetDisplayedLine(i));
+		if (LineIndex == 0 && bHasElements)
+		{
+			Out += FormatPrefix(*Message, Out, GetPrefixSize(*Message));
+		}
+
+		const char* LineBegin;
+		const char* LineEnd;
+		const FImGuiOutputLogText Text = Message->GetText();
+		Message->GetLine(Text, LineIndex, LineBegin, LineEnd);
+		FMemory::Memcpy(Out, LineBegin, LineEnd - LineBegin);
+		Out += LineEnd - LineBegin;
+		*Out++ = '\n';
 	}
 
-	strcat_s(Fmt, "%s"); // Actual text
-	ToAllocate++; // \0
+	*Out = '\0';
+	ImGui::SetClipboardText(Buffer.GetData());
+}
 
-	Message->FormattedTextLen = ToAllocate - 1;
-	Message->FormattedText = static_cast<char*>(IM_ALLOC(ToAllocate));
-	sprintf_s(Message->FormattedText, ToAllocate, Fmt, ToAppend[0], ToAppend[1], ToAppend[2], Message->Text);
+void FImGuiEngineLogView::FindSearchCandidates()
+{
+	bUseSearchCandidates = false;
 
-	int32 i = 0;
-	for (; Message->FormattedText[i] != '\0'; ++i)
+	// Only the live log is indexed
+	const FImGuiOutputLogTrigramIndex* SearchIndex = Owner.LogBuffer->GetSearchIndex();
+	if (!SearchIndex || Store != Owner.LiveStore || !Filter.IsActive())
 	{
-		if (Message->FormattedText[i] == '\n')
-		{
-			break;
-		}
+		return;
+	}
+
+	int32 IndexedNum;
+	if (!Filter.FindCandidates(*SearchIndex, SearchCandidates, IndexedNum))
+	{
+		return;
 	}
 
-	Message->LineOffsets[0] = i;
+	// Both the index and the live store count from the start of the buffer
+	SearchCandidatesEnd = IndexedNum;
+	NextSearchCandidate = Algo::LowerBound(SearchCandidates, BaseMessage);
+	bUseSearchCandidates = true;
 }
 
-void FImGuiEngineLogImpl::ValidateMessages()
+void FImGuiEngineLogView::Clear()
 {
-	if (bElementsDirty)
+	// Messages that are already in the source but haven't made it to the store are cleared as well
+	ResetView(GetSourceMessagesNum());
+}
+
+void FImGuiEngineLogView::ResetView(int32 InBaseMessage)
+{
+	BaseMessage = InBaseMessage;
+	FilteredToNormal.Empty();
+	SearchCandidates.Empty();
+	bUseSearchCandidates = false;
+	LinesOfText = 0;
+	SkipToMessage(BaseMessage);
+	Minimap.Reset();
+	FrameStarts.Empty();
+	WrapLayout.Reset();
+	WrapAnchorLine = INDEX_NONE;
+	ScrollAnchorLineIndex = INDEX_NONE;
+	bRestoreScrollAnchor = false;
+	SelectionAnchor = SelectionEnd = INDEX_NONE;
+	bIsSelecting = false;
+	bFiltersDirty = true;
+
+	// A file is read from the top, the live log from the bottom
+	bFollowTail = !FileSource;
+	LastScrollY = 0.f;
+}
+
+void FImGuiEngineLogView::StartExport()
+{
+	const FString Filename = UTF8_TO_TCHAR(ExportFilename);
+
+	// The displayed messages are a span of the store, unless only the ones that passed the filter are
+	const bool bIsFiltered = !bExportFullLog && Filter.IsActive();
+	int32 Begin = bExportFullLog ? 0 : BaseMessage;
+	int32 End = bExportFullLog ? GetSourceMessagesNum() : FMath::Min(ProcessedMessagesNum, Store->GetMessagesNum());
+	TArray<int32> Filtered;
+	if (bIsFiltered)
 	{
-		const int32 Num = Messages.Num();
-		for (int32 i = 0; i < Num; ++i)
+		for (const int32 Line : FilteredToNormal)
 		{
-			auto Message = Messages[i];
-
-			FormatMessage(Message);
-			if (!bFiltersDirty && Filter.IsActive())
-			{
-				TryFilteringMessage(MessageToLine(i));
-			}
-			else
+			// Every line of a message that passed the filter is in the list, but the message has to be written once
+			const int32 Index = Store->FindMessageOfLine(Line);
+			if (Filtered.IsEmpty() || Filtered.Last() != Index)
 			{
-				LinesOfText += Message->LineOffsets.Num();
+				Filtered.Add(Index);
 			}
 		}
 
-		bElementsDirty = false;
+		Begin = 0;
+		End = Filtered.Num();
+	}
+
+	End = FMath::Max(Begin, End);
+
+	// A file may not fit in memory as message objects, so they're only made as they're written
+	if (FileSource)
+	{
+		Exporter.Start(Filename, ExportFormat, End - Begin,
+			[FileSource = FileSource, Filtered = MoveTemp(Filtered), Begin, bIsFiltered](int32 Index)
+			{
+				return FileSource->MakeMessage(bIsFiltered ? Filtered[Index] : Begin + Index);
+			});
+
+		return;
 	}
 
-	if (!Filter.IsActive() && LinesOfText == 0)
+	// Only the references are copied; the text is read straight from the messages by the exporter
+	TArray<ImGui::Private::TMessageRef> ToExport;
+	if (bExportFullLog)
+	{
+		ToExport = GetSourceMessages();
+	}
+	else
 	{
-		LinesOfText = MultiLineMessages.Num();
+		ToExport.Reserve(End - Begin);
+		for (int32 i = Begin; i < End; ++i)
+		{
+			ToExport.Add(Store->GetStoredMessage(bIsFiltered ? Filtered[i] : i));
+		}
 	}
+
+	Exporter.Start(Filename, ExportFormat, MoveTemp(ToExport));
 }
 
-void FImGuiEngineLogImpl::Clear()
+void FImGuiEngineLogView::OpenLogFile()
 {
-	Messages.Empty();
-	MultiLineMessages.Empty();
-	FilteredToNormal.Empty();
-	LinesOfText = 0;
+	LoadingFileSource = MakeShared<FImGuiOutputLogFileSource>();
+	FileOpenTime = FPlatformTime::Seconds();
+
+	FileLoadingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[FileSource = LoadingFileSource, Filename = FString(UTF8_TO_TCHAR(LogFilename))]
+		{
+			return FileSource->Open(Filename);
+		});
 }
 
-void FImGuiEngineLogImpl::TryFilteringMessage(int32 Index)
+void FImGuiEngineLogView::AttachSharedLog()
 {
-	auto Message = MultiLineMessages[Index].Key;
-	Message->bIsFilteredOut = !Filter.PassFilter(Message);
-
-	if (!Message->bIsFilteredOut)
+	auto NewSharedSource = MakeShared<FImGuiOutputLogSharedRingReader>();
+	if (!NewSharedSource->Attach(UTF8_TO_TCHAR(SharedLogName)))
 	{
-		FilteredToNormal.Add(Index);
-		LinesOfText++;
+		UE_LOG(LogImGuiOutputLog, Warning, TEXT("Failed to attach to shared log %s"), UTF8_TO_TCHAR(SharedLogName));
+		return;
 	}
+
+	SetSource(nullptr, MoveTemp(NewSharedSource));
 }
 
-void FImGuiEngineLogImpl::FilterAllMessages()
+void FImGuiEngineLogView::SetSource(TSharedPtr<FImGuiOutputLogFileSource> InFileSource,
+	TSharedPtr<FImGuiOutputLogSharedRingReader> InSharedSource)
 {
-	const int32 Num = Messages.Num();
-	for (int32 i = 0; i < Num; ++i)
+	// The exported messages may point into the file that is about to be closed
+	if (Exporter.IsRunning())
+	{
+		Exporter.Cancel();
+		Exporter.Wait();
+	}
+
+	// Anything but the live log gets a store of its own, which goes away along with it
+	FileSource = MoveTemp(InFileSource);
+	SharedSource = MoveTemp(InSharedSource);
+	if (FileSource)
+	{
+		Store = MakeShared<FImGuiOutputLogStore>(FileSource.ToSharedRef());
+	}
+	else
+	{
+		Store = SharedSource ? MakeShared<FImGuiOutputLogStore>() : Owner.LiveStore;
+	}
+
+	Filter.Context.ResetCategories();
+	Filter.ResetCategoryVerdicts();
+	KnownCategoriesNum = 0;
+	ResetView(0);
+
+	if (!FileSource)
 	{
-		TryFilteringMessage(MessageToLine(i));
+		FileOpenTime = 0.0;
 	}
 }
 
-int32 FImGuiEngineLogImpl::MessageToLine(int32 MessageIndex) const
+void FImGuiEngineLogView::SetRange(const FImGuiOutputLogFilter::FRange& Range)
+{
+	Filter.Context.Range = Range;
+	bFiltersDirty = true;
+
+	// Keep the popup showing what's in effect, whoever set it
+	const auto FormatTime = [](int64 Ticks, int64 OpenTicks, char* Out, int32 OutSize)
+	{
+		const FString Time = Ticks != OpenTicks ? FDateTime(Ticks).ToString(TEXT("%Y.%m.%d-%H.%M.%S:%s")) : FString();
+		ImStrncpy(Out, TCHAR_TO_UTF8(*Time), OutSize);
+	};
+
+	const auto FormatFrame = [](uint64 Frame, uint64 OpenFrame, char* Out, int32 OutSize)
+	{
+		Out[0] = '\0';
+		if (Frame != OpenFrame)
+		{
+			FCStringAnsi::Snprintf(Out, OutSize, "%llu", Frame);
+		}
+	};
+
+	FormatTime(Range.MinTicks, MIN_int64, RangeFromTime, IM_ARRAYSIZE(RangeFromTime));
+	FormatTime(Range.MaxTicks, MAX_int64, RangeToTime, IM_ARRAYSIZE(RangeToTime));
+	FormatFrame(Range.MinFrame, 0, RangeFromFrame, IM_ARRAYSIZE(RangeFromFrame));
+	FormatFrame(Range.MaxFrame, MAX_uint64, RangeToFrame, IM_ARRAYSIZE(RangeToFrame));
+}
+
+void FImGuiEngineLogView::TryFilteringMessage(const ImGui::Private::TMessageRef& Message, int32 Index)
 {
-	int32 Count = 0;
-	for (const auto& Message : Messages)
+	// The messages are shared with the other views, so the verdict isn't stored in them
+	if (Filter.PassFilter(Message))
 	{
-		const int32 Lines = Message->LineOffsets.Num();
-		Count += Lines;
+		const int32 Lines = Message->GetLinesNum();
+		Minimap.Add(Message->Verbosity, Lines);
+		AddFrameStart(*Message, FilteredToNormal.Num());
 
-		if (Count > MessageIndex)
+		for (int32 i = 0; i < Lines; ++i)
 		{
-			return Count - Lines;
+			FilteredToNormal.Add(Index + i);
 		}
 	}
+}
 
-	checkNoEntry();
-	return INDEX_NONE;
+SIZE_T FImGuiEngineLogView::GetAllocatedSize() const
+{
+	return FilteredToNormal.GetAllocatedSize() + SearchCandidates.GetAllocatedSize() + FrameStarts.GetAllocatedSize();
 }
 
 static ImU32 ColorToU32(const FLinearColor& Color)
@@ -627,28 +2420,13 @@ static ImU32 DefaultVerbosityToColor(EImGuiLogVerbosity Verbosity)
 	}
 }
 
-ImU32 FImGuiEngineLogImpl::VerbosityToColor(EImGuiLogVerbosity Verbosity)
+ImU32 FImGuiEngineLogView::VerbosityToColor(EImGuiLogVerbosity Verbosity)
 {
 	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
 	const FLinearColor* FoundColor = Settings->Colors.Find(Verbosity);
 	return FoundColor ? ColorToU32(*FoundColor) : DefaultVerbosityToColor(Verbosity);
 }
 
-const char* FImGuiEngineLogImpl::VerbosityToString(EImGuiLogVerbosity Verbosity)
-{
-	switch (Verbosity)
-	{
-	case EImGuiLogVerbosity::Verbose: return "Verbose";
-	case EImGuiLogVerbosity::VeryVerbose: return "Very Verbose";
-	case EImGuiLogVerbosity::Log: return "Log";
-	case EImGuiLogVerbosity::Display: return "Display";
-	case EImGuiLogVerbosity::Warning: return "Warning";
-	case EImGuiLogVerbosity::Error: return "Error";
-	case EImGuiLogVerbosity::Fatal: return "Fatal";
-	default: return "Invalid";
-	}
-}
-
 UImGuiEngineOutputLogSettings::UImGuiEngineOutputLogSettings()
 {
 	for (const auto Verbosity : TEnumRange<EImGuiLogVerbosity>())
@@ -661,3 +2439,17 @@ FName UImGuiEngineOutputLogSettings::GetCategoryName() const
 {
 	return "Plugins";
 }
+
+#if WITH_EDITOR
+void UImGuiEngineOutputLogSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// The rules are compiled when they're set, so edits have to be handed over, while there's a log to feed them
+	const bool bHasLogBuffer = GEngine && GEngine->GetEngineSubsystem<UImGuiOutputLogBuffer>();
+	if (bHasLogBuffer && PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ThisClass, AlertRules))
+	{
+		FImGuiOutputLogAlerts::Get().SetRules(AlertRules);
+	}
+}
+#endif
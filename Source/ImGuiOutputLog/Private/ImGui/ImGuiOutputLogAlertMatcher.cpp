@@ -0,0 +1,173 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogAlertMatcher.h"
+
+#include "Containers/Queue.h"
+
+FImGuiOutputLogAlertMatcher::FImGuiOutputLogAlertMatcher(const TArray<FImGuiOutputLogAlertRule>& InRules)
+	: Rules(InRules)
+{
+	LastMatches.Init(0, Rules.Num());
+	Build();
+}
+
+void FImGuiOutputLogAlertMatcher::Match(const ImGui::Private::TMessage& Message, const FImGuiOutputLogText& Text,
+	TFunctionRef<void(int32)> OnMatch)
+{
+	++MatchNumber;
+
+	const FCategoryRules& Category = GetCategoryRules(Message);
+	for (const int32 RuleIndex : Category.PatternlessRules)
+	{
+		if (Message.Verbosity <= Rules[RuleIndex].Verbosity)
+		{
+			OnMatch(RuleIndex);
+		}
+	}
+
+	int32 State = 0;
+	for (const char* It = Text.Begin; It < Text.End; ++It)
+	{
+		const char Char = FCharAnsi::ToLower(*It);
+
+		int32 Next = FindEdge(State, Char);
+		while (Next == INDEX_NONE && State != 0)
+		{
+			State = Nodes[State].Fail;
+			Next = FindEdge(State, Char);
+		}
+
+		State = Next != INDEX_NONE ? Next : 0;
+
+		int32 Output = Nodes[State].Rules.IsEmpty() ? Nodes[State].OutputLink : State;
+		for (; Output != INDEX_NONE; Output = Nodes[Output].OutputLink)
+		{
+			for (const int32 RuleIndex : Nodes[Output].Rules)
+			{
+				if (LastMatches[RuleIndex] != MatchNumber && Category.Passed[RuleIndex]
+					&& Message.Verbosity <= Rules[RuleIndex].Verbosity)
+				{
+					LastMatches[RuleIndex] = MatchNumber;
+					OnMatch(RuleIndex);
+				}
+			}
+		}
+	}
+}
+
+int32 FImGuiOutputLogAlertMatcher::FindEdge(int32 Node, char Char) const
+{
+	for (const auto& [EdgeChar, Target] : Nodes[Node].Edges)
+	{
+		if (EdgeChar == Char)
+		{
+			return Target;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+void FImGuiOutputLogAlertMatcher::Build()
+{
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+
+	// Trie of the patterns
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); ++RuleIndex)
+	{
+		const FString& Pattern = Rules[RuleIndex].Pattern;
+		if (Pattern.IsEmpty())
+		{
+			continue;
+		}
+
+		const auto AnsiPattern = StringCast<ANSICHAR>(*Pattern);
+		int32 Node = 0;
+		for (const char* It = AnsiPattern.Get(); *It != '\0'; ++It)
+		{
+			const char Char = FCharAnsi::ToLower(*It);
+			int32 Next = FindEdge(Node, Char);
+			if (Next == INDEX_NONE)
+			{
+				Next = Nodes.AddDefaulted();
+				Nodes[Node].Edges.Add({ Char, Next });
+			}
+
+			Node = Next;
+		}
+
+		Nodes[Node].Rules.Add(RuleIndex);
+	}
+
+	// Fail links, breadth first so that the ones of shorter strings are known by the time they're needed
+	TQueue<int32> Queue;
+	for (const auto& [_, Child] : Nodes[0].Edges)
+	{
+		Queue.Enqueue(Child);
+	}
+
+	int32 Node;
+	while (Queue.Dequeue(Node))
+	{
+		for (const auto& [Char, Child] : Nodes[Node].Edges)
+		{
+			int32 Fail = Nodes[Node].Fail;
+			int32 Next = FindEdge(Fail, Char);
+			while (Next == INDEX_NONE && Fail != 0)
+			{
+				Fail = Nodes[Fail].Fail;
+				Next = FindEdge(Fail, Char);
+			}
+
+			FNode& ChildNode = Nodes[Child];
+			ChildNode.Fail = Next != INDEX_NONE ? Next : 0;
+			ChildNode.OutputLink = Nodes[ChildNode.Fail].Rules.IsEmpty()
+				? Nodes[ChildNode.Fail].OutputLink
+				: ChildNode.Fail;
+
+			Queue.Enqueue(Child);
+		}
+	}
+}
+
+const FImGuiOutputLogAlertMatcher::FCategoryRules& FImGuiOutputLogAlertMatcher::GetCategoryRules(
+	const ImGui::Private::TMessage& Message)
+{
+	FCategoryRules* Result = &UnindexedCategoryRules;
+	if (Message.CategoryIndex != INDEX_NONE)
+	{
+		if (Message.CategoryIndex >= CategoryRules.Num())
+		{
+			CategoryRules.SetNum(Message.CategoryIndex + 1);
+		}
+
+		Result = &CategoryRules[Message.CategoryIndex];
+		if (Result->Passed.Num() > 0)
+		{
+			return *Result;
+		}
+	}
+
+	Result->Passed.Init(false, Rules.Num());
+	Result->PatternlessRules.Reset();
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); ++RuleIndex)
+	{
+		if (PassCategory(RuleIndex, Message))
+		{
+			Result->Passed[RuleIndex] = true;
+			if (Rules[RuleIndex].Pattern.IsEmpty())
+			{
+				Result->PatternlessRules.Add(RuleIndex);
+			}
+		}
+	}
+
+	return *Result;
+}
+
+bool FImGuiOutputLogAlertMatcher::PassCategory(int32 RuleIndex, const ImGui::Private::TMessage& Message) const
+{
+	const FString& Category = Rules[RuleIndex].Category;
+	return Category.IsEmpty() || FString(Message.CategoryLen, Message.Category).MatchesWildcard(Category);
+}
@@ -0,0 +1,63 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiEngineOutputLog.h"
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+/**
+ * Alert rules compiled into an Aho-Corasick automaton over their patterns, case insensitive. A message is walked
+ * through once, and only the rules whose pattern was found have their category and verbosity checked. Rules without a
+ * pattern are looked up by category, which is decided once per category.
+ *
+ * Not thread-safe; it caches what it decided about categories, so it belongs to one thread at a time.
+ */
+class FImGuiOutputLogAlertMatcher
+{
+public:
+	explicit FImGuiOutputLogAlertMatcher(const TArray<FImGuiOutputLogAlertRule>& InRules);
+
+	/** Calls back once for every rule the message matches. */
+	void Match(const ImGui::Private::TMessage& Message, const FImGuiOutputLogText& Text,
+		TFunctionRef<void(int32)> OnMatch);
+
+private:
+	struct FNode
+	{
+	public:
+		TArray<TPair<char, int32>, TInlineAllocator<4>> Edges;
+
+		// Longest proper suffix of this node's string that is a node as well
+		int32 Fail = 0;
+
+		// Closest node down the fail links that ends a pattern
+		int32 OutputLink = INDEX_NONE;
+
+		// Rules whose pattern ends here
+		TArray<int32, TInlineAllocator<1>> Rules;
+	};
+
+	struct FCategoryRules
+	{
+	public:
+		TBitArray<> Passed;
+		TArray<int32> PatternlessRules;
+	};
+
+	int32 FindEdge(int32 Node, char Char) const;
+	void Build();
+	const FCategoryRules& GetCategoryRules(const ImGui::Private::TMessage& Message);
+	bool PassCategory(int32 RuleIndex, const ImGui::Private::TMessage& Message) const;
+
+private:
+	TArray<FImGuiOutputLogAlertRule> Rules;
+	TArray<FNode> Nodes;
+
+	// Indexed by category index; messages without one have theirs decided every time
+	TArray<FCategoryRules> CategoryRules;
+	FCategoryRules UnindexedCategoryRules;
+
+	// Number of the message each rule last matched, so a pattern found twice in a message only counts once
+	TArray<uint32> LastMatches;
+	uint32 MatchNumber = 0;
+};
@@ -0,0 +1,134 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogAlerts.h"
+
+#include "Engine/Engine.h"
+#include "ImGui/ImGuiOutputLogAlertMatcher.h"
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGuiOutputLogStats.h"
+
+static constexpr float ToastDuration = 8.f;
+
+FImGuiOutputLogAlerts::~FImGuiOutputLogAlerts()
+{
+	Reset();
+}
+
+FImGuiOutputLogAlerts& FImGuiOutputLogAlerts::Get()
+{
+	static FImGuiOutputLogAlerts Instance;
+	return Instance;
+}
+
+void FImGuiOutputLogAlerts::SetRules(const TArray<FImGuiOutputLogAlertRule>& InRules)
+{
+	check(IsInGameThread());
+
+	Reset();
+	if (InRules.IsEmpty())
+	{
+		return;
+	}
+
+	Matcher = MakeUnique<FImGuiOutputLogAlertMatcher>(InRules);
+	ToastRules.Init(false, InRules.Num());
+	for (int32 i = 0; i < InRules.Num(); ++i)
+	{
+		ToastRules[i] = InRules[i].bShowToast;
+	}
+
+	LastToastTimes.Init(-DBL_MAX, InRules.Num());
+	Ticker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FImGuiOutputLogAlerts::Tick));
+}
+
+void FImGuiOutputLogAlerts::Add(const TSharedRef<FImGuiOutputLogMessage>& Message)
+{
+	if (Matcher)
+	{
+		Pending.Add(Message);
+	}
+}
+
+void FImGuiOutputLogAlerts::Reset()
+{
+	if (Ticker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(Ticker);
+		Ticker.Reset();
+	}
+
+	Task.Wait();
+	Task = {};
+	Matcher.Reset();
+	Pending.Empty();
+	Results.Empty();
+}
+
+bool FImGuiOutputLogAlerts::Tick(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	if (!Task.IsCompleted())
+	{
+		return true;
+	}
+
+	if (!Results.IsEmpty())
+	{
+		Broadcast(MoveTemp(Results));
+		Results.Reset();
+	}
+
+	if (!Pending.IsEmpty())
+	{
+		// Registered here rather than on the task, so that nothing can be moved to the cold tier in between
+		FImGuiOutputLogColdStore::Get().AddReader();
+
+		Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Messages = MoveTemp(Pending)]
+		{
+			LLM_SCOPE_BYTAG(ImGuiOutputLog);
+			Match(Messages);
+			FImGuiOutputLogColdStore::Get().RemoveReader();
+		}, UE::Tasks::ETaskPriority::BackgroundNormal);
+
+		Pending.Reset();
+	}
+
+	return true;
+}
+
+void FImGuiOutputLogAlerts::Match(const TArray<TSharedRef<FImGuiOutputLogMessage>>& Messages)
+{
+	for (const auto& Message : Messages)
+	{
+		const FImGuiOutputLogText Text = Message->GetText();
+		Matcher->Match(*Message, Text, [this, &Message, &Text](int32 RuleIndex)
+		{
+			FImGuiOutputLogAlert& Alert = Results.AddDefaulted_GetRef();
+			Alert.RuleIndex = RuleIndex;
+			Alert.Text = FString(static_cast<int32>(Text.End - Text.Begin), Text.Begin);
+			Alert.Category = FString(Message->CategoryLen, Message->Category);
+			Alert.Verbosity = Message->Verbosity;
+			Alert.Timestamp = Message->Timestamp;
+			Alert.Frame = Message->Frame;
+		});
+	}
+}
+
+void FImGuiOutputLogAlerts::Broadcast(TArray<FImGuiOutputLogAlert>&& Alerts)
+{
+	const float Cooldown = GetDefault<UImGuiEngineOutputLogSettings>()->AlertToastCooldown;
+	const double Now = FPlatformTime::Seconds();
+	for (const FImGuiOutputLogAlert& Alert : Alerts)
+	{
+		OnAlertDelegate.Broadcast(Alert);
+
+		if (GEngine && ToastRules[Alert.RuleIndex] && Now - LastToastTimes[Alert.RuleIndex] >= Cooldown)
+		{
+			LastToastTimes[Alert.RuleIndex] = Now;
+			GEngine->AddOnScreenDebugMessage(INDEX_NONE, ToastDuration,
+				Alert.Verbosity <= EImGuiLogVerbosity::Error ? FColor::Red : FColor::Yellow,
+				FString::Printf(TEXT("%s: %s"), *Alert.Category, *Alert.Text));
+		}
+	}
+}
@@ -0,0 +1,466 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "HAL/IConsoleManager.h"
+#include "imgui_internal.h"
+#include "ImGuiOutputLog.h"
+#include "ImGui/ImGuiEngineOutputLog.h"
+#include "ImGui/ImGuiOutputLogBuffer.h"
+#include "ImGui/ImGuiOutputLogDetachedView.h"
+#include "ImGui/ImGuiOutputLogExporter.h"
+#include "ImGui/ImGuiOutputLogFilter.h"
+#include "ImGui/ImGuiOutputLogMessage.h"
+#include "ImGui/ImGuiOutputLogSharedRing.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectGlobals.h"
+
+static void MakeBenchmarkMessages(int32 Num, TArray<ImGui::Private::TMessageRef>& OutMessages,
+	FImGuiOutputLogFilter::FContext& OutContext)
+{
+	static const char* Categories[] = { "LogTemp", "LogNet", "LogNetTraffic", "LogStreaming", "LogRHI", "LogAudio" };
+	static const char* Texts[] =
+	{
+		"Actor %d spawned at (%d, %d, %d)",
+		"Connection timeout after %d ms, retrying",
+		"Loaded package /Game/Maps/Level_%d in %d ms",
+		"Replicated %d properties of %d actors",
+		"Texture streaming pool over budget by %d KB (%d requests)",
+		"Sound wave %d failed to decompress: error %d",
+	};
+
+	for (const char* Category : Categories)
+	{
+		OutContext.Categories.Add({ ImStrdup(Category), true });
+	}
+
+	// Roughly the mix of a busy session: mostly logs, some warnings, a few errors
+	const FDateTime StartTime = FDateTime::Now() - FTimespan::FromSeconds(Num / 1000.0);
+	FRandomStream Random(Num);
+	OutMessages.Reserve(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		char Text[256];
+		FCStringAnsi::Snprintf(Text, sizeof(Text), Texts[Random.RandHelper(UE_ARRAY_COUNT(Texts))],
+			Random.RandHelper(100000), Random.RandHelper(1000), Random.RandHelper(1000), Random.RandHelper(1000));
+
+		const int32 CategoryIndex = Random.RandHelper(UE_ARRAY_COUNT(Categories));
+		const int32 Roll = Random.RandHelper(100);
+
+		auto& Message = OutMessages.Add_GetRef(MakeShared<ImGui::Private::TMessage>());
+		Message->Text = ImStrdup(Text);
+		Message->TextLen = ImStrlen(Message->Text);
+		Message->Category = ImStrdup(Categories[CategoryIndex]);
+		Message->CategoryLen = ImStrlen(Message->Category);
+		Message->CategoryIndex = CategoryIndex;
+		Message->Verbosity = Roll < 2 ? EImGuiLogVerbosity::Error
+			: Roll < 10 ? EImGuiLogVerbosity::Warning
+			: EImGuiLogVerbosity::Log;
+		Message->Timestamp = StartTime + FTimespan::FromMilliseconds(i);
+		Message->Sequence = i;
+		Message->Frame = i / 20;
+	}
+}
+
+static void BenchmarkQueries(const TArray<FString>& Args)
+{
+	const int32 MessagesNum = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000;
+
+	FImGuiOutputLogFilter Filter;
+	TArray<ImGui::Private::TMessageRef> Messages;
+	MakeBenchmarkMessages(MessagesNum, Messages, Filter.Context);
+
+	static const char* Queries[] =
+	{
+		"timeout",
+		"timeout, failed",
+		"\"Connection timeout\"",
+		"cat:LogNet*",
+		"cat:LogNet* lvl>=Warning",
+		"lvl>=Error texture",
+		"cat:LogNet* lvl>=Warning \"timeout after\" -retrying",
+		"since:-30s",
+		"frame:1200..1300",
+		"frame:1200..1300 cat:LogStreaming package",
+		"-Actor",
+	};
+
+	for (const char* Query : Queries)
+	{
+		Filter.SetQuery(Query);
+
+		const double StartTime = FPlatformTime::Seconds();
+		int32 PassedNum = 0;
+		for (const auto& Message : Messages)
+		{
+			PassedNum += Filter.PassFilter(Message);
+		}
+
+		UE_LOG(LogImGuiOutputLog, Display, TEXT("%-55s %8.2f ms, %d of %d passed"), ANSI_TO_TCHAR(Query),
+			(FPlatformTime::Seconds() - StartTime) * 1000.0, PassedNum, MessagesNum);
+	}
+}
+
+static FAutoConsoleCommand BenchmarkQueriesCommand(
+	TEXT("imguilog.bench.query"),
+	TEXT("Times a mix of search queries over generated messages. Usage: imguilog.bench.query [MessagesNum=1000000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkQueries));
+
+static void BenchmarkIngestion(const TArray<FString>& Args)
+{
+	const int32 MessagesNum = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000;
+	const uint64 RingCapacity = 16 * 1024 * 1024;
+
+	FImGuiOutputLogFilter::FContext Context;
+	TArray<ImGui::Private::TMessageRef> Messages;
+	MakeBenchmarkMessages(MessagesNum, Messages, Context);
+
+	// The work the buffer does for every message whatever else is enabled, followed by the write being measured
+	const auto Ingest = [&Messages](TFunctionRef<void(const ImGui::Private::TMessage&)> Write)
+	{
+		TArray<ImGui::Private::TMessageRef> Copies;
+		Copies.Reserve(Messages.Num());
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (const auto& Message : Messages)
+		{
+			auto& Copy = Copies.Add_GetRef(MakeShared<ImGui::Private::TMessage>());
+			Copy->Text = ImStrdup(Message->Text);
+			Copy->TextLen = Message->TextLen;
+			Copy->FindLineBreaks();
+			Copy->Category = ImStrdup(Message->Category);
+			Copy->CategoryLen = Message->CategoryLen;
+			Copy->Verbosity = Message->Verbosity;
+			Copy->Timestamp = Message->Timestamp;
+			Copy->Sequence = Message->Sequence;
+			Copy->Frame = Message->Frame;
+			Write(*Copy);
+		}
+
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	const auto Report = [MessagesNum](const TCHAR* Name, double Time, double BaseTime)
+	{
+		UE_LOG(LogImGuiOutputLog, Display, TEXT("%-20s %8.2f ms, %6.1f ns per message, %+6.1f%% over memory only"),
+			Name, Time * 1000.0, Time * 1e9 / MessagesNum, BaseTime > 0.0 ? (Time / BaseTime - 1.0) * 100.0 : 0.0);
+	};
+
+	const double MemoryTime = Ingest([](const ImGui::Private::TMessage&) {});
+	Report(TEXT("Memory only"), MemoryTime, MemoryTime);
+
+	const FString RingFilename = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("ImGuiOutputLogBench"),
+		TEXT(".ring"));
+	{
+		FImGuiOutputLogSharedRingWriter FileRing;
+		if (FileRing.CreateInFile(RingFilename, RingCapacity))
+		{
+			Report(TEXT("Crash log file"), Ingest([&FileRing](const ImGui::Private::TMessage& Message)
+			{
+				FileRing.Write(Message);
+			}), MemoryTime);
+		}
+	}
+	IFileManager::Get().Delete(*RingFilename);
+
+	FImGuiOutputLogSharedRingWriter SharedRing;
+	if (SharedRing.Create(TEXT("ImGuiOutputLogBench"), RingCapacity))
+	{
+		Report(TEXT("Shared memory"), Ingest([&SharedRing](const ImGui::Private::TMessage& Message)
+		{
+			SharedRing.Write(Message);
+		}), MemoryTime);
+	}
+}
+
+static FAutoConsoleCommand BenchmarkIngestionCommand(
+	TEXT("imguilog.bench.ingest"),
+	TEXT("Times storing generated messages in memory only, and along with writing them to the crash log file or the ")
+	TEXT("shared memory ring. Usage: imguilog.bench.ingest [MessagesNum=1000000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkIngestion));
+
+/** Messages fed to the buffer by the suite; generated up front, so that only the logging itself is timed. */
+struct FBenchmarkCorpus
+{
+public:
+	const TCHAR* Name = TEXT("");
+	TArray<FString> Texts;
+	TArray<FName> Categories;
+	TArray<ELogVerbosity::Type> Verbosities;
+
+	// Threads logging at the same time; the messages are split evenly between them
+	int32 ProducersNum = 1;
+};
+
+struct FBenchmarkResult
+{
+public:
+	FString Corpus;
+	FString Pass;
+	int32 MessagesNum = 0;
+	int64 Bytes = 0;
+	double Time = 0.0;
+
+	// How much the resident memory of the process went up by, whoever it was allocated by
+	int64 ResidentDeltaBytes = 0;
+	uint64 PeakUsedBytes = 0;
+};
+
+static FBenchmarkCorpus MakeBenchmarkCorpus(const TCHAR* Name, int32 Num, int32 CategoriesNum, int32 LinesNum,
+	int32 ProducersNum)
+{
+	FBenchmarkCorpus Corpus;
+	Corpus.Name = Name;
+	Corpus.ProducersNum = ProducersNum;
+
+	TArray<FName> CategoryNames;
+	for (int32 i = 0; i < CategoriesNum; ++i)
+	{
+		CategoryNames.Add(FName(*FString::Printf(TEXT("LogBench%d"), i)));
+	}
+
+	FRandomStream Random(Num);
+	Corpus.Texts.Reserve(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		// Multi-line messages look like the call stacks of ensures
+		FString Text = FString::Printf(TEXT("Connection %d timed out after %d ms"), Random.RandHelper(100000),
+			Random.RandHelper(1000));
+		for (int32 Line = 1; Line < LinesNum; ++Line)
+		{
+			Text += FString::Printf(TEXT("\n[Callstack] 0x%08x UnrealEditor-Engine.dll!UWorld::Tick() [World.cpp:%d]"),
+				Random.RandHelper(MAX_int32), Random.RandHelper(10000));
+		}
+
+		const int32 Roll = Random.RandHelper(100);
+		Corpus.Texts.Add(MoveTemp(Text));
+		Corpus.Categories.Add(CategoryNames[Random.RandHelper(CategoriesNum)]);
+		Corpus.Verbosities.Add(Roll < 2 ? ELogVerbosity::Error
+			: Roll < 10 ? ELogVerbosity::Warning
+			: ELogVerbosity::Log);
+	}
+
+	return Corpus;
+}
+
+static FBenchmarkResult MeasureBenchmarkPass(const FBenchmarkCorpus& Corpus, const TCHAR* Pass,
+	TFunctionRef<void()> Run)
+{
+	FBenchmarkResult Result;
+	Result.Corpus = Corpus.Name;
+	Result.Pass = Pass;
+	Result.MessagesNum = Corpus.Texts.Num();
+	for (const FString& Text : Corpus.Texts)
+	{
+		Result.Bytes += Text.Len();
+	}
+
+	const int64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+	const double StartTime = FPlatformTime::Seconds();
+	Run();
+	Result.Time = FPlatformTime::Seconds() - StartTime;
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	Result.ResidentDeltaBytes = static_cast<int64>(MemoryStats.UsedPhysical) - UsedBefore;
+	Result.PeakUsedBytes = MemoryStats.PeakUsedPhysical;
+	return Result;
+}
+
+static void IngestBenchmarkCorpus(const FBenchmarkCorpus& Corpus, UImGuiOutputLogBuffer& Buffer)
+{
+	const int32 Num = Corpus.Texts.Num();
+	const int32 PerProducer = (Num + Corpus.ProducersNum - 1) / Corpus.ProducersNum;
+	const auto Produce = [&Corpus, &Buffer, Num](int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < FMath::Min(End, Num); ++i)
+		{
+			Buffer.Serialize(*Corpus.Texts[i], Corpus.Verbosities[i], Corpus.Categories[i]);
+		}
+	};
+
+	if (Corpus.ProducersNum == 1)
+	{
+		Produce(0, Num);
+		return;
+	}
+
+	TArray<UE::Tasks::FTask> Producers;
+	for (int32 i = 0; i < Corpus.ProducersNum; ++i)
+	{
+		Producers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Produce, i, PerProducer]
+		{
+			Produce(i * PerProducer, (i + 1) * PerProducer);
+		}));
+	}
+
+	UE::Tasks::Wait(Producers);
+
+	// The messages of other threads are added by the game thread before the next one it logs
+	Buffer.Serialize(TEXT("Producers done"), ELogVerbosity::Log, TEXT("LogBench"));
+}
+
+static void DrawBenchmarkFrames(FImGuiOutputLogDetachedView& View, int32 FramesNum)
+{
+	// Scrolls through the whole log over the frames, as when dragging the scrollbar
+	const int32 LinesNum = View.GetLinesNum();
+	for (int32 Frame = 0; Frame < FramesNum; ++Frame)
+	{
+		View.Tick(static_cast<int32>(static_cast<int64>(LinesNum) * Frame / FramesNum));
+	}
+}
+
+static void WriteBenchmarkResults(const FString& Filename, const TArray<FBenchmarkResult>& Results)
+{
+	// Appended to, so that the file keeps the history of every run to compare against
+	FString Csv;
+	if (!IFileManager::Get().FileExists(*Filename))
+	{
+		Csv += TEXT("Date,Build,Corpus,Pass,Messages,Bytes,TimeMs,MessagesPerSecond,NsPerMessage,ResidentDeltaMB,")
+			TEXT("PeakMB\n");
+	}
+
+	const FString Date = FDateTime::Now().ToString();
+	for (const FBenchmarkResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%s,%s,%d,%lld,%.3f,%.0f,%.1f,%.2f,%.2f\n"), *Date, FApp::GetBuildVersion(),
+			*Result.Corpus, *Result.Pass, Result.MessagesNum, Result.Bytes, Result.Time * 1000.0,
+			Result.Time > 0.0 ? Result.MessagesNum / Result.Time : 0.0, Result.Time * 1e9 / Result.MessagesNum,
+			Result.ResidentDeltaBytes / (1024.0 * 1024.0), Result.PeakUsedBytes / (1024.0 * 1024.0));
+	}
+
+	FFileHelper::SaveStringToFile(Csv, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+		&IFileManager::Get(), FILEWRITE_Append);
+}
+
+static void RunBenchmarkSuite(const TArray<FString>& Args)
+{
+	const int32 MessagesNum = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200000;
+	const FString Filename = Args.Num() > 1
+		? Args[1]
+		: FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("ImGuiOutputLogBench.csv");
+
+	TArray<FBenchmarkCorpus> Corpora;
+	Corpora.Add(MakeBenchmarkCorpus(TEXT("ShortSpam"), MessagesNum, 6, 1, 1));
+	Corpora.Add(MakeBenchmarkCorpus(TEXT("Callstacks"), MessagesNum / 20, 6, 24, 1));
+	Corpora.Add(MakeBenchmarkCorpus(TEXT("ManyCategories"), MessagesNum, 1000, 1, 1));
+	Corpora.Add(MakeBenchmarkCorpus(TEXT("Producers"), MessagesNum, 6, 1, 4));
+
+	static const char* Queries[] =
+	{
+		"timeout",
+		"cat:LogBench1* lvl>=Warning",
+		"\"timed out after 5\"",
+		"-Connection",
+	};
+
+	TArray<FBenchmarkResult> Results;
+	for (const FBenchmarkCorpus& Corpus : Corpora)
+	{
+		// Not hooked up to GLog, so the live log is left alone, and kept out of the alerts, the cold tier and the stats
+		UImGuiOutputLogBuffer* Buffer = UImGuiOutputLogBuffer::CreateDetached();
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("Serialize"), [&Corpus, Buffer]
+		{
+			IngestBenchmarkCorpus(Corpus, *Buffer);
+		}));
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("Store"), [Buffer]
+		{
+			Buffer->UpdateLiveStore(TNumericLimits<double>::Max());
+		}));
+
+		// The rest goes through the log window itself, as it's drawn on screen
+		TUniquePtr<FImGuiOutputLogDetachedView> View = MakeUnique<FImGuiOutputLogDetachedView>(Buffer);
+		View->Tick();
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("Filter"), [&View]
+		{
+			for (const char* Query : Queries)
+			{
+				View->SetQuery(Query);
+			}
+		}));
+
+		View->SetQuery("");
+		View->SetDisplayedElements(EImGuiOutputLogMessageElement::Category | EImGuiOutputLogMessageElement::Timestamp
+			| EImGuiOutputLogMessageElement::Verbosity | EImGuiOutputLogMessageElement::Thread);
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("Format"), [&View]
+		{
+			View->FormatAllPrefixes();
+		}));
+
+		View->SelectAll();
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("Draw"), [&View]
+		{
+			DrawBenchmarkFrames(*View, 600);
+		}));
+
+		View->SetWrapLines(true);
+
+		Results.Add(MeasureBenchmarkPass(Corpus, TEXT("DrawWrapped"), [&View]
+		{
+			DrawBenchmarkFrames(*View, 600);
+		}));
+
+		// Opened from a file of its own, as a log of the same size would be
+		const FString LogFilename = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("ImGuiOutputLogBench"),
+			TEXT(".log"));
+
+		FImGuiOutputLogExporter Exporter;
+		TArray<ImGui::Private::TMessageRef> ToExport = Buffer->Messages;
+		if (Exporter.Start(LogFilename, EImGuiOutputLogExportFormat::PlainText, MoveTemp(ToExport)))
+		{
+			Exporter.Wait();
+		}
+
+		if (Exporter.GetResult() == FImGuiOutputLogExporter::EResult::Succeeded)
+		{
+			// Up to the first screen of the file; the parsing alone is reported as a pass of its own
+			double ParseTime = 0.0;
+			const FBenchmarkResult OpenResult = MeasureBenchmarkPass(Corpus, TEXT("Open"),
+				[&View, &LogFilename, &ParseTime]
+				{
+					View->OpenFile(LogFilename, ParseTime);
+				});
+
+			FBenchmarkResult ParseResult = OpenResult;
+			ParseResult.Pass = TEXT("Parse");
+			ParseResult.Time = ParseTime;
+
+			Results.Add(OpenResult);
+			Results.Add(MoveTemp(ParseResult));
+		}
+
+		// The file stays mapped for as long as the view shows it
+		View.Reset();
+		IFileManager::Get().Delete(*LogFilename);
+
+		Buffer->Messages.Empty();
+		Buffer->MarkAsGarbage();
+
+		// The next corpus starts from where this one did, rather than on top of its messages
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	for (const FBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogImGuiOutputLog, Display, TEXT("%-15s %-11s %10.2f ms, %8.1f ns per message, %+8.1f MB resident"),
+			*Result.Corpus, *Result.Pass, Result.Time * 1000.0, Result.Time * 1e9 / Result.MessagesNum,
+			Result.ResidentDeltaBytes / (1024.0 * 1024.0));
+	}
+
+	WriteBenchmarkResults(Filename, Results);
+	UE_LOG(LogImGuiOutputLog, Display, TEXT("Benchmark results appended to %s"), *Filename);
+}
+
+static FAutoConsoleCommand RunBenchmarkSuiteCommand(
+	TEXT("imguilog.bench.suite"),
+	TEXT("Logs generated messages through a buffer of its own, then times storing them and filtering, formatting and ")
+	TEXT("drawing them in the log window, and opening them again from a file. Appends the times and the change of the ")
+	TEXT("resident memory to a CSV file. Runs headless, e.g. with -nullrhi -unattended ")
+	TEXT("-ExecCmds=\"imguilog.bench.suite, quit\". Usage: imguilog.bench.suite [MessagesNum=200000] [Filename]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmarkSuite));
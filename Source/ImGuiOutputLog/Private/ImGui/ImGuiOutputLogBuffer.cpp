@@ -3,11 +3,78 @@
 #include "ImGui/ImGuiOutputLogBuffer.h"
 
 #include "imgui_internal.h"
+#include "ImGuiOutputLog.h"
+#include "ImGuiOutputLogStats.h"
+#include "ImGui/ImGuiEngineOutputLog.h"
+#include "ImGui/ImGuiOutputLogAlerts.h"
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGui/ImGuiOutputLogStore.h"
+#include "ImGui/ImGuiOutputLogThreads.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+// Looking for messages to move to the cold tier after every single one would be a waste
+static constexpr int32 FreezeCheckInterval = 256;
+
+static int32 GetCurrentPlayInEditorId()
+{
+#if UE_VERSION_NEWER_THAN_OR_EQUAL(5, 5, 0)
+	return UE::GetPlayInEditorID();
+#else
+	return GPlayInEditorID;
+#endif
+}
 
 void UImGuiOutputLogBuffer::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	if (Settings->bBuildSearchIndex)
+	{
+		SearchIndex = MakeUnique<FImGuiOutputLogTrigramIndex>();
+	}
+
+	// Headless servers are more easily configured from the command line
+	FString SharedLogName = Settings->SharedLogName;
+	FParse::Value(FCommandLine::Get(), TEXT("ImGuiLogShm="), SharedLogName);
+	if (!SharedLogName.IsEmpty())
+	{
+		SharedRing = MakeUnique<FImGuiOutputLogSharedRingWriter>();
+		if (!SharedRing->Create(SharedLogName, Settings->SharedLogSizeMB * 1024ull * 1024ull))
+		{
+			UE_LOG(LogImGuiOutputLog, Warning, TEXT("Failed to create shared log %s"), *SharedLogName);
+			SharedRing.Reset();
+		}
+	}
+
+	if (Settings->bKeepCrashLog)
+	{
+		// Whatever the previous session left is kept until the next one
+		const FString CrashLogFilename = GetCrashLogFilename();
+		if (IFileManager::Get().FileExists(*CrashLogFilename))
+		{
+			IFileManager::Get().Move(*GetPreviousCrashLogFilename(), *CrashLogFilename);
+		}
+
+		CrashRing = MakeUnique<FImGuiOutputLogSharedRingWriter>();
+		if (!CrashRing->CreateInFile(CrashLogFilename, Settings->CrashLogSizeMB * 1024ull * 1024ull))
+		{
+			UE_LOG(LogImGuiOutputLog, Warning, TEXT("Failed to create crash log %s"), *CrashLogFilename);
+			CrashRing.Reset();
+		}
+	}
+
+	FImGuiOutputLogAlerts::Get().SetRules(Settings->AlertRules);
+
+	LiveStore = MakeShared<FImGuiOutputLogStore>();
+
+	Ticker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UImGuiOutputLogBuffer::Tick));
+
 	check(GLog);
 	GLog->AddOutputDevice(this);
 }
@@ -19,35 +86,293 @@ void UImGuiOutputLogBuffer::Deinitialize()
 		GLog->RemoveOutputDevice(this);
 	}
 
+	FTSTicker::GetCoreTicker().RemoveTicker(Ticker);
+	PendingMessages.Empty();
+
+	// The views still holding the store keep it alive, though nothing is added to it anymore
+	UE::Tasks::Wait(LiveStoreReaders);
+	LiveStoreReaders.Empty();
+	LiveStore.Reset();
+
+	SearchIndex.Reset();
+	SharedRing.Reset();
+	CrashRing.Reset();
+	FImGuiOutputLogAlerts::Get().Reset();
+
 	Super::Deinitialize();
 }
 
 void UImGuiOutputLogBuffer::Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category)
 {
-	if (Verbosity >= ELogVerbosity::Fatal && Verbosity <= ELogVerbosity::VeryVerbose && Message && Message[0] != '\0')
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiOutputLog_Serialize);
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	if (Verbosity < ELogVerbosity::Fatal || Verbosity > ELogVerbosity::VeryVerbose || !Message || Message[0] == '\0')
 	{
-		auto& LogMessage = Messages.Add_GetRef(MakeShared<ImGui::Private::TMessage>());
+		return;
+	}
+
+	const ImGui::Private::TMessageRef LogMessage = MakeShared<ImGui::Private::TMessage>();
 
-		LogMessage->Text = ImStrdup(TCHAR_TO_ANSI(Message));
+	LogMessage->Text = ImStrdup(TCHAR_TO_ANSI(Message));
+	LogMessage->TextLen = ImStrlen(LogMessage->Text);
+	LogMessage->FindLineBreaks();
 
-		int32 PreviousOffset = 0;
-		int32 i = 0;
-		for (; LogMessage->Text[i] != '\0'; ++i)
+	LogMessage->Category = ImStrdup(TCHAR_TO_ANSI(*Category.ToString()));
+	LogMessage->CategoryLen = ImStrlen(LogMessage->Category);
+
+	LogMessage->Verbosity = static_cast<EImGuiLogVerbosity>(Verbosity);
+	LogMessage->ThreadIndex = FImGuiOutputLogThreads::Get().GetCurrentThreadIndex();
+
+	if (IsInGameThread())
+	{
+		AddPendingMessages();
+		AddMessage(LogMessage, Category, false);
+		return;
+	}
+
+	// The game thread may never get to it if the process is going down, and what's logged then, e.g. the errors and the
+	// callstack of a crash, comes from other threads; it's only a copy into the mapping anyway
+	const bool bInCrashRing = CrashRing.IsValid();
+	if (bInCrashRing)
+	{
+		LogMessage->Timestamp = FDateTime::Now();
+		LogMessage->Frame = GFrameCounter;
+
+		FScopeLock Lock(&CrashRingCritical);
+		CrashRing->Write(*LogMessage);
+	}
+
+	PendingMessages.Enqueue({ LogMessage, Category, bInCrashRing });
+}
+
+bool UImGuiOutputLogBuffer::Tick(float DeltaTime)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	AddPendingMessages();
+
+	// Retried every frame as well, as nothing may be logged once the readers are done
+	if (bFreezePending)
+	{
+		FreezeOldMessages();
+	}
+
+	if (DeltaTime > 0.f)
+	{
+		SET_FLOAT_STAT(STAT_ImGuiOutputLog_MessagesPerSecond, (Messages.Num() - LastTickMessagesNum) / DeltaTime);
+	}
+
+	LastTickMessagesNum = Messages.Num();
+
+	// The time since the last tick is what the previous frame took
+	const uint64 Frame = GFrameCounter - 1;
+	if (GFrameCounter > 0 && DeltaTime * 1000.f >= GetDefault<UImGuiEngineOutputLogSettings>()->HitchThresholdMs)
+	{
+		FImGuiOutputLogFrameStats& Hitch = Hitches.AddDefaulted_GetRef();
+		if (FrameStats.Frame == Frame)
 		{
-			if (LogMessage->Text[i] == '\n')
-			{
-				LogMessage->LineOffsets.Add(i - PreviousOffset);
-				PreviousOffset = i;
-			}
+			Hitch = FrameStats;
+		}
+		else if (PreviousFrameStats.Frame == Frame)
+		{
+			Hitch = PreviousFrameStats;
 		}
-		
-		LogMessage->TextLen = i;
-		LogMessage->LineOffsets.Add(LogMessage->TextLen - PreviousOffset);
 
-		LogMessage->Category = ImStrdup(TCHAR_TO_ANSI(*Category.ToString()));
-		LogMessage->CategoryLen = ImStrlen(LogMessage->Category);
+		Hitch.Frame = Frame;
+		Hitch.DeltaTime = DeltaTime;
+	}
 
-		LogMessage->Verbosity = static_cast<EImGuiLogVerbosity>(Verbosity);
-		LogMessage->Timestamp = FDateTime::Now();
+	return true;
+}
+
+void UImGuiOutputLogBuffer::AddPendingMessages()
+{
+	FPendingMessage Pending;
+	while (PendingMessages.Dequeue(Pending))
+	{
+		AddMessage(Pending.Message.ToSharedRef(), Pending.Category, Pending.bInCrashRing);
+	}
+}
+
+void UImGuiOutputLogBuffer::AddMessage(const ImGui::Private::TMessageRef& LogMessage, const FName& Category,
+	bool bInCrashRing)
+{
+	LogMessage->CategoryIndex = CategoryIndices.FindOrAdd(Category, CategoryIndices.Num());
+
+	// Stamped here rather than when logged, so that the messages stay sorted by time however late they get here
+	LogMessage->Timestamp = FDateTime::Now();
+	LogMessage->Sequence = Messages.Num();
+	LogMessage->Frame = GFrameCounter;
+	LogMessage->PlayInEditorId = GetCurrentPlayInEditorId();
+
+	if (FrameStats.Frame != LogMessage->Frame)
+	{
+		PreviousFrameStats = FrameStats;
+		FrameStats = {};
+		FrameStats.Frame = LogMessage->Frame;
+	}
+
+	FrameStats.MessagesNum++;
+	FrameStats.LinesNum += LogMessage->GetLinesNum();
+	FrameStats.Bytes += LogMessage->TextLen;
+
+	if (!bIsDetached)
+	{
+		INC_MEMORY_STAT_BY(STAT_ImGuiOutputLog_StoredBytes, LogMessage->TextLen + LogMessage->CategoryLen + 2);
+	}
+
+	// Only added once complete, as other threads may be reading the messages
+	{
+		FWriteScopeLock Lock(MessagesLock);
+		Messages.Add(LogMessage);
+	}
+
+	if (SearchIndex)
+	{
+		SearchIndex->Update(Messages);
+	}
+
+	if (bIsDetached)
+	{
+		return;
+	}
+
+	FImGuiOutputLogAlerts::Get().Add(LogMessage);
+
+	if (SharedRing)
+	{
+		SharedRing->Write(*LogMessage);
+	}
+
+	// Just a copy into the mapping; the OS writes it out whenever, even after a crash
+	if (CrashRing && !bInCrashRing)
+	{
+		FScopeLock Lock(&CrashRingCritical);
+		CrashRing->Write(*LogMessage);
+	}
+
+	if (bFreezePending || Messages.Num() % FreezeCheckInterval == 0)
+	{
+		FreezeOldMessages();
+	}
+}
+
+bool UImGuiOutputLogBuffer::CanBeUsedOnAnyThread() const
+{
+	return true;
+}
+
+bool UImGuiOutputLogBuffer::CanBeUsedOnMultipleThreads() const
+{
+	return true;
+}
+
+const FImGuiOutputLogTrigramIndex* UImGuiOutputLogBuffer::GetSearchIndex() const
+{
+	return SearchIndex.Get();
+}
+
+const TSharedPtr<FImGuiOutputLogStore>& UImGuiOutputLogBuffer::GetLiveStore() const
+{
+	return LiveStore;
+}
+
+void UImGuiOutputLogBuffer::UpdateLiveStore(double Deadline)
+{
+	check(IsInGameThread());
+
+	LiveStoreReaders.RemoveAll([](const UE::Tasks::FTask& Task)
+	{
+		return Task.IsCompleted();
+	});
+
+	if (!LiveStore || !LiveStoreReaders.IsEmpty())
+	{
+		return;
+	}
+
+	LiveStore->AddNewMessages(Messages, Deadline);
+
+	if (!bIsDetached)
+	{
+		SET_DWORD_STAT(STAT_ImGuiOutputLog_Lines, LiveStore->GetLinesNum());
+	}
+}
+
+void UImGuiOutputLogBuffer::AddLiveStoreReader(const UE::Tasks::FTask& Task)
+{
+	check(IsInGameThread());
+	LiveStoreReaders.Add(Task);
+}
+
+UImGuiOutputLogBuffer* UImGuiOutputLogBuffer::CreateDetached()
+{
+	UImGuiOutputLogBuffer* Buffer = NewObject<UImGuiOutputLogBuffer>(GetTransientPackage());
+	Buffer->bIsDetached = true;
+	Buffer->LiveStore = MakeShared<FImGuiOutputLogStore>();
+	return Buffer;
+}
+
+bool UImGuiOutputLogBuffer::IsDetached() const
+{
+	return bIsDetached;
+}
+
+FString UImGuiOutputLogBuffer::GetCrashLogFilename()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir() / TEXT("ImGuiOutputLog-Crash.ring"));
+}
+
+FString UImGuiOutputLogBuffer::GetPreviousCrashLogFilename()
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir() / TEXT("ImGuiOutputLog-Crash-Previous.ring"));
+}
+
+void UImGuiOutputLogBuffer::FreezeOldMessages()
+{
+	const auto* Settings = GetDefault<UImGuiEngineOutputLogSettings>();
+	auto& ColdStore = FImGuiOutputLogColdStore::Get();
+	const int32 FreezableEnd = Messages.Num() - Settings->MaxHotMessages;
+	if (Settings->MaxHotMessages <= 0 || FirstHotIndex >= FreezableEnd)
+	{
+		bFreezePending = false;
+		return;
+	}
+
+	// Tried again as soon as the readers are gone, rather than after the next interval's worth of messages, as with
+	// readers coming and going all the time the checks could keep missing the moments there are none
+	bFreezePending = true;
+	if (ColdStore.HasReaders())
+	{
+		return;
+	}
+
+	// Readers on other threads register while holding the lock, so they can't start in the middle of this
+	FWriteScopeLock Lock(MessagesLock);
+	if (ColdStore.HasReaders())
+	{
+		return;
+	}
+
+	bFreezePending = false;
+
+	while (FirstHotIndex < FreezableEnd)
+	{
+		int32 BlockEnd = FirstHotIndex;
+		int32 BlockSize = 0;
+		while (BlockEnd < FreezableEnd && BlockSize < FImGuiOutputLogColdStore::BlockSize)
+		{
+			BlockSize += Messages[BlockEnd++]->TextLen + 1;
+		}
+
+		// Tiny blocks would compress poorly, so wait for enough old messages to fill one
+		if (BlockSize < FImGuiOutputLogColdStore::BlockSize)
+		{
+			break;
+		}
+
+		ColdStore.Freeze(MakeArrayView(Messages.GetData() + FirstHotIndex, BlockEnd - FirstHotIndex));
+		FirstHotIndex = BlockEnd;
 	}
 }
@@ -2,31 +2,131 @@
 
 #pragma once
 
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "ImGui/ImGuiOutputLogMessage.h"
-#include "Subsystems/GameInstanceSubsystem.h"
+#include "ImGui/ImGuiOutputLogSharedRing.h"
+#include "ImGui/ImGuiOutputLogTrigramIndex.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Tasks/Task.h"
 
 #include "ImGuiOutputLogBuffer.generated.h"
 
+class FImGuiOutputLogStore;
+
+/** What was logged during a frame, e.g. one that took longer than it should have. */
+struct FImGuiOutputLogFrameStats
+{
+public:
+	uint64 Frame = 0;
+	float DeltaTime = 0.f;
+	int32 MessagesNum = 0;
+	int32 LinesNum = 0;
+	int64 Bytes = 0;
+};
+
 /**
+ * Captures everything written to GLog. There's one for the whole engine, no matter how many game instances there are
+ * in PIE; their logs read from it, and tell their own messages apart by the PIE instance stored in each.
  *
+ * It's called on the thread that logs, so that the thread can be told; messages from other threads than the game
+ * thread are queued, and added on the game thread before the next message it logs, or on the next frame.
  */
 UCLASS(NotBlueprintType)
 class UImGuiOutputLogBuffer
-	: public UGameInstanceSubsystem
+	: public UEngineSubsystem
 	, public FOutputDevice
 {
 	GENERATED_BODY()
 
 public:
-	//~UGameInstanceSubsystem Interface
+	//~UEngineSubsystem Interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
-	//~End of UGameInstanceSubsystem Interface
+	//~End of UEngineSubsystem Interface
 
 	//~FOutputDevice Interface
 	virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override;
+	virtual bool CanBeUsedOnMultipleThreads() const override;
 	//~End of FOutputDevice Interface
 
+	const FImGuiOutputLogTrigramIndex* GetSearchIndex() const;
+
+	/**
+	 * Store of the live log, shared by the views of every game instance, so that the messages are split into lines
+	 * once however many clients there are in PIE. Null until initialized.
+	 */
+	const TSharedPtr<FImGuiOutputLogStore>& GetLiveStore() const;
+
+	/**
+	 * Adds the new messages to the live store until the deadline. Nothing is added while tasks registered through
+	 * AddLiveStoreReader are still running, as they may be reading it; the messages are picked up by a later call.
+	 * Game thread only.
+	 */
+	void UpdateLiveStore(double Deadline);
+	void AddLiveStoreReader(const UE::Tasks::FTask& Task);
+
+	static FString GetCrashLogFilename();
+	static FString GetPreviousCrashLogFilename();
+
+	/**
+	 * Makes a buffer that isn't the one of the engine, e.g. for the benchmark suite. It isn't hooked up to GLog, and
+	 * stays out of what the whole process shares: the alerts, the cold tier and the stats. It's logged to by calling
+	 * Serialize, and has a live store of its own from the start.
+	 */
+	static UImGuiOutputLogBuffer* CreateDetached();
+	bool IsDetached() const;
+
+private:
+	bool Tick(float DeltaTime);
+	void AddPendingMessages();
+	void AddMessage(const ImGui::Private::TMessageRef& LogMessage, const FName& Category, bool bInCrashRing);
+	void FreezeOldMessages();
+
 public:
+	// Only ever appended to, on the game thread; other threads have to hold the lock for reading
 	TArray<ImGui::Private::TMessageRef> Messages;
+	mutable FRWLock MessagesLock;
+
+	// Frames that took longer than the threshold of the settings, oldest first; game thread only
+	TArray<FImGuiOutputLogFrameStats> Hitches;
+
+private:
+	bool bIsDetached = false;
+
+	// Messages before this one have their texts in the cold tier
+	int32 FirstHotIndex = 0;
+
+	// Set while old messages are waiting for the readers of the cold store to be done
+	bool bFreezePending = false;
+
+	TUniquePtr<FImGuiOutputLogTrigramIndex> SearchIndex;
+
+	TSharedPtr<FImGuiOutputLogStore> LiveStore;
+	TArray<UE::Tasks::FTask> LiveStoreReaders;
+	TUniquePtr<FImGuiOutputLogSharedRingWriter> SharedRing;
+	TUniquePtr<FImGuiOutputLogSharedRingWriter> CrashRing;
+	FCriticalSection CrashRingCritical;
+
+	TMap<FName, int32> CategoryIndices;
+
+	// Messages logged from other threads, waiting for the game thread
+	struct FPendingMessage
+	{
+	public:
+		TSharedPtr<ImGui::Private::TMessage> Message;
+		FName Category;
+
+		// Written to the crash log right away, rather than once the game thread gets to it
+		bool bInCrashRing = false;
+	};
+
+	TQueue<FPendingMessage, EQueueMode::Mpsc> PendingMessages;
+	FTSTicker::FDelegateHandle Ticker;
+
+	// What has been logged during the current frame and the one before it; a frame's time is only known on the next
+	FImGuiOutputLogFrameStats FrameStats;
+	FImGuiOutputLogFrameStats PreviousFrameStats;
+	int32 LastTickMessagesNum = 0;
 };
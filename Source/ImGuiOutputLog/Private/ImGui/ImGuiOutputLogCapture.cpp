@@ -0,0 +1,477 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogCapture.h"
+
+#include "Async/ParallelFor.h"
+#include "ImGui/ImGuiOutputLogMessageColumns.h"
+#include "ImGuiOutputLogStats.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <atomic>
+
+static constexpr uint32 CaptureMagic = 0x434C4749; // "IGLC"
+static constexpr uint32 CaptureVersion = 2;
+static constexpr uint32 FirstVersionWithFrames = 2;
+static constexpr int32 FooterSize = 8 + 8 + 4 + 8 + 4 + 4;
+static constexpr int32 BlockIndexEntrySize = 8 + 4 + 4 + 4 + 8;
+static constexpr int32 BlockTextSize = 64 * 1024;
+
+// LZ4 can't do better than this, so a block claiming more is corrupt; checked before anything is allocated for it
+static constexpr uint64 MaxCompressionRatio = 255;
+
+static void WriteVarint(TArray<uint8>& Out, uint64 Value)
+{
+	while (Value >= 0x80)
+	{
+		Out.Add(static_cast<uint8>(Value) | 0x80);
+		Value >>= 7;
+	}
+
+	Out.Add(static_cast<uint8>(Value));
+}
+
+static uint64 ZigZag(int64 Value)
+{
+	return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+}
+
+static int64 UnZigZag(uint64 Value)
+{
+	return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+}
+
+template<typename T>
+static void WriteRaw(TArray<uint8>& Out, T Value)
+{
+	Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+}
+
+/** Bounds-checked cursor over the loaded bytes; once it fails everything it returns is zero. */
+struct FCaptureReader
+{
+public:
+	FCaptureReader(const uint8* InBegin, const uint8* InEnd)
+		: It(InBegin)
+		, End(InEnd)
+	{
+	}
+
+	uint64 ReadVarint()
+	{
+		uint64 Value = 0;
+		for (int32 Shift = 0; Shift < 64; Shift += 7)
+		{
+			if (It >= End)
+			{
+				bFailed = true;
+				return 0;
+			}
+
+			const uint8 Byte = *It++;
+			Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return Value;
+			}
+		}
+
+		bFailed = true;
+		return 0;
+	}
+
+	template<typename T>
+	T ReadRaw()
+	{
+		T Value = 0;
+		if (End - It < static_cast<int64>(sizeof(T)))
+		{
+			bFailed = true;
+			return Value;
+		}
+
+		FMemory::Memcpy(&Value, It, sizeof(T));
+		It += sizeof(T);
+		return Value;
+	}
+
+	const uint8* Skip(int64 Len)
+	{
+		if (Len < 0 || End - It < Len)
+		{
+			bFailed = true;
+			return nullptr;
+		}
+
+		const uint8* Begin = It;
+		It += Len;
+		return Begin;
+	}
+
+public:
+	const uint8* It;
+	const uint8* End;
+	bool bFailed = false;
+};
+
+FImGuiOutputLogCaptureWriter::FImGuiOutputLogCaptureWriter(FWriteFunction InWrite)
+	: Write(MoveTemp(InWrite))
+{
+}
+
+void FImGuiOutputLogCaptureWriter::Add(const ImGui::Private::TMessage& Message)
+{
+	const FName CategoryName(Message.CategoryLen, Message.Category);
+	int32* CategoryIndex = CategoryIndices.Find(CategoryName);
+	if (!CategoryIndex)
+	{
+		CategoryIndex = &CategoryIndices.Add(CategoryName, Categories.Add(CategoryName));
+	}
+
+	const int64 Timestamp = Message.Timestamp.GetTicks();
+	if (VerbosityColumn.IsEmpty())
+	{
+		BlockFirstTimestamp = Timestamp;
+		PreviousTimestamp = Timestamp;
+		PreviousFrame = 0;
+	}
+
+	WriteVarint(CategoryColumn, *CategoryIndex);
+	VerbosityColumn.Add(static_cast<uint8>(Message.Verbosity));
+	WriteVarint(TimestampColumn, ZigZag(Timestamp - PreviousTimestamp));
+	WriteVarint(FrameColumn, ZigZag(static_cast<int64>(Message.Frame - PreviousFrame)));
+	const FImGuiOutputLogText Text = Message.GetText();
+	WriteVarint(LengthColumn, Message.TextLen);
+	TextColumn.Append(reinterpret_cast<const uint8*>(Text.Begin), Message.TextLen);
+	TextColumn.Add('\0');
+
+	PreviousTimestamp = Timestamp;
+	PreviousFrame = Message.Frame;
+	MessagesNum++;
+
+	// What the same message takes in a log file: [2025.06.01-12.34.56:789]Category: Verbosity: Text\n
+	RawLogSize += 25 + Message.CategoryLen + 2 + Message.TextLen + 1;
+	if (Message.Verbosity != EImGuiLogVerbosity::Log)
+	{
+		RawLogSize += FCStringAnsi::Strlen(ImGui::Private::TMessage::VerbosityToString(Message.Verbosity)) + 2;
+	}
+
+	if (TextColumn.Num() >= BlockTextSize)
+	{
+		FlushBlock();
+	}
+}
+
+void FImGuiOutputLogCaptureWriter::Finish()
+{
+	FlushBlock();
+
+	TArray<uint8> Tail;
+
+	const uint64 CategoriesOffset = WrittenSize;
+	WriteVarint(Tail, Categories.Num());
+	for (const FName Category : Categories)
+	{
+		const FString CategoryString = Category.ToString();
+		const auto Converted = StringCast<ANSICHAR>(*CategoryString, CategoryString.Len());
+		WriteVarint(Tail, Converted.Length());
+		Tail.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	const uint64 BlockIndexOffset = WrittenSize + Tail.Num();
+	for (const FBlock& Block : Blocks)
+	{
+		WriteRaw(Tail, Block.Offset);
+		WriteRaw(Tail, Block.CompressedSize);
+		WriteRaw(Tail, Block.UncompressedSize);
+		WriteRaw(Tail, Block.MessagesNum);
+		WriteRaw(Tail, Block.FirstTimestamp);
+	}
+
+	WriteRaw(Tail, CategoriesOffset);
+	WriteRaw(Tail, BlockIndexOffset);
+	WriteRaw(Tail, static_cast<uint32>(Blocks.Num()));
+	WriteRaw(Tail, MessagesNum);
+	WriteRaw(Tail, CaptureVersion);
+	WriteRaw(Tail, CaptureMagic);
+
+	Emit(Tail.GetData(), Tail.Num());
+}
+
+int64 FImGuiOutputLogCaptureWriter::GetWrittenSize() const
+{
+	return WrittenSize;
+}
+
+int64 FImGuiOutputLogCaptureWriter::GetRawLogSize() const
+{
+	return RawLogSize;
+}
+
+void FImGuiOutputLogCaptureWriter::FlushBlock()
+{
+	const int32 BlockMessagesNum = VerbosityColumn.Num();
+	if (BlockMessagesNum == 0)
+	{
+		return;
+	}
+
+	// The deltas start from the first message, which is stored in the index so that any block can be read on its own
+	FBlock& Block = Blocks.AddDefaulted_GetRef();
+	Block.Offset = WrittenSize;
+	Block.MessagesNum = BlockMessagesNum;
+	Block.FirstTimestamp = BlockFirstTimestamp;
+
+	TArray<uint8> Uncompressed;
+	Uncompressed.Reserve(CategoryColumn.Num() + VerbosityColumn.Num() + TimestampColumn.Num() + FrameColumn.Num()
+		+ LengthColumn.Num() + TextColumn.Num());
+	Uncompressed.Append(CategoryColumn);
+	Uncompressed.Append(VerbosityColumn);
+	Uncompressed.Append(TimestampColumn);
+	Uncompressed.Append(FrameColumn);
+	Uncompressed.Append(LengthColumn);
+	Uncompressed.Append(TextColumn);
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Uncompressed.Num());
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	verify(FCompression::CompressMemory(NAME_LZ4, Compressed.GetData(), CompressedSize,
+		Uncompressed.GetData(), Uncompressed.Num()));
+
+	Block.CompressedSize = CompressedSize;
+	Block.UncompressedSize = Uncompressed.Num();
+	Emit(Compressed.GetData(), CompressedSize);
+
+	CategoryColumn.Reset();
+	VerbosityColumn.Reset();
+	TimestampColumn.Reset();
+	FrameColumn.Reset();
+	LengthColumn.Reset();
+	TextColumn.Reset();
+}
+
+void FImGuiOutputLogCaptureWriter::Emit(const void* Data, int32 Len)
+{
+	Write(static_cast<const uint8*>(Data), Len);
+	WrittenSize += Len;
+}
+
+FImGuiOutputLogCapture::~FImGuiOutputLogCapture()
+{
+	for (char* Category : Categories)
+	{
+		free(Category);
+	}
+}
+
+bool FImGuiOutputLogCapture::Load(const FString& Filename, FImGuiOutputLogMessageColumns& OutColumns)
+{
+	TArray64<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Filename) || Data.Num() < FooterSize)
+	{
+		return false;
+	}
+
+	const uint8* DataBegin = Data.GetData();
+	const uint8* DataEnd = DataBegin + Data.Num();
+
+	FCaptureReader Footer(DataEnd - FooterSize, DataEnd);
+	const uint64 CategoriesOffset = Footer.ReadRaw<uint64>();
+	const uint64 BlockIndexOffset = Footer.ReadRaw<uint64>();
+	const uint32 BlocksNum = Footer.ReadRaw<uint32>();
+	const uint64 MessagesNum = Footer.ReadRaw<uint64>();
+	const uint32 Version = Footer.ReadRaw<uint32>();
+	const uint32 Magic = Footer.ReadRaw<uint32>();
+
+	if (Footer.bFailed || Magic != CaptureMagic || Version == 0 || Version > CaptureVersion
+		|| CategoriesOffset > static_cast<uint64>(Data.Num()) || BlockIndexOffset > static_cast<uint64>(Data.Num()))
+	{
+		return false;
+	}
+
+	FCaptureReader CategoriesReader(DataBegin + CategoriesOffset, DataEnd);
+	const uint64 CategoriesNum = CategoriesReader.ReadVarint();
+	for (uint64 i = 0; i < CategoriesNum && !CategoriesReader.bFailed; ++i)
+	{
+		const int64 Len = CategoriesReader.ReadVarint();
+		const uint8* Begin = CategoriesReader.Skip(Len);
+		if (Begin)
+		{
+			char* Category = static_cast<char*>(malloc(Len + 1));
+			FMemory::Memcpy(Category, Begin, Len);
+			Category[Len] = '\0';
+			Categories.Add(Category);
+		}
+	}
+
+	struct FBlockEntry
+	{
+		uint64 Offset;
+		uint32 CompressedSize;
+		uint32 UncompressedSize;
+		uint32 MessagesNum;
+		int64 FirstTimestamp;
+	};
+
+	// The sizes come from the file, so they're checked against it before anything is allocated from them
+	const uint64 BlockIndexSize = static_cast<uint64>(BlocksNum) * BlockIndexEntrySize;
+	if (BlockIndexOffset + BlockIndexSize > static_cast<uint64>(Data.Num() - FooterSize))
+	{
+		return false;
+	}
+
+	TArray<FBlockEntry> BlockEntries;
+	BlockEntries.SetNumUninitialized(BlocksNum);
+	uint64 TotalMessagesNum = 0;
+
+	FCaptureReader IndexReader(DataBegin + BlockIndexOffset, DataEnd);
+	for (FBlockEntry& Entry : BlockEntries)
+	{
+		Entry.Offset = IndexReader.ReadRaw<uint64>();
+		Entry.CompressedSize = IndexReader.ReadRaw<uint32>();
+		Entry.UncompressedSize = IndexReader.ReadRaw<uint32>();
+		Entry.MessagesNum = IndexReader.ReadRaw<uint32>();
+		Entry.FirstTimestamp = IndexReader.ReadRaw<int64>();
+
+		// Every message takes at least its text's '\0'
+		if (Entry.Offset > CategoriesOffset || Entry.CompressedSize > CategoriesOffset - Entry.Offset
+			|| Entry.UncompressedSize > FMath::Min<uint64>(MAX_int32, Entry.CompressedSize * MaxCompressionRatio)
+			|| Entry.MessagesNum > Entry.UncompressedSize)
+		{
+			IndexReader.bFailed = true;
+		}
+
+		TotalMessagesNum += Entry.MessagesNum;
+	}
+
+	if (CategoriesReader.bFailed || IndexReader.bFailed || TotalMessagesNum != MessagesNum
+		|| TotalMessagesNum > static_cast<uint64>(MAX_int32 - OutColumns.Num()))
+	{
+		return false;
+	}
+
+	// Blocks don't depend on each other, so they're all decoded at once
+	Blocks.SetNum(BlocksNum);
+	TArray<FImGuiOutputLogMessageColumns> BlockColumns;
+	BlockColumns.SetNum(BlocksNum);
+	std::atomic<bool> bFailed = false;
+
+	ParallelFor(BlocksNum, [&](int32 BlockIndex)
+	{
+		LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+		const FBlockEntry& Entry = BlockEntries[BlockIndex];
+		TArray<uint8>& Block = Blocks[BlockIndex];
+		Block.SetNumUninitialized(Entry.UncompressedSize);
+
+		if (!FCompression::UncompressMemory(NAME_LZ4, Block.GetData(), Entry.UncompressedSize,
+			DataBegin + Entry.Offset, Entry.CompressedSize))
+		{
+			bFailed = true;
+			return;
+		}
+
+		// The columns are made of varints, so each one has to be read to know where the next one begins
+		const int32 Num = Entry.MessagesNum;
+		const uint8* BlockEnd = Block.GetData() + Block.Num();
+
+		TArray<uint32> CategoryIndices;
+		CategoryIndices.SetNumUninitialized(Num);
+		FCaptureReader CategoryReader(Block.GetData(), BlockEnd);
+		for (uint32& CategoryIndex : CategoryIndices)
+		{
+			CategoryIndex = CategoryReader.ReadVarint();
+		}
+
+		const uint8* Verbosities = CategoryReader.Skip(Num);
+
+		TArray<int64> Timestamps;
+		Timestamps.SetNumUninitialized(Num);
+		FCaptureReader TimestampReader(CategoryReader.It, BlockEnd);
+		int64 Timestamp = Entry.FirstTimestamp;
+		for (int64& MessageTimestamp : Timestamps)
+		{
+			Timestamp += UnZigZag(TimestampReader.ReadVarint());
+			MessageTimestamp = Timestamp;
+		}
+
+		// Older captures don't know about frames
+		TArray<uint64> Frames;
+		Frames.SetNumZeroed(Num);
+		FCaptureReader FrameReader(TimestampReader.It, BlockEnd);
+		if (Version >= FirstVersionWithFrames)
+		{
+			uint64 Frame = 0;
+			for (uint64& MessageFrame : Frames)
+			{
+				Frame += UnZigZag(FrameReader.ReadVarint());
+				MessageFrame = Frame;
+			}
+		}
+
+		// The texts follow the lengths, so the lengths are read twice
+		FCaptureReader LengthReader(FrameReader.It, BlockEnd);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			LengthReader.ReadVarint();
+		}
+
+		const uint8* Text = LengthReader.It;
+		LengthReader = FCaptureReader(FrameReader.It, BlockEnd);
+
+		if (CategoryReader.bFailed || TimestampReader.bFailed || FrameReader.bFailed || LengthReader.bFailed)
+		{
+			bFailed = true;
+			return;
+		}
+
+		FImGuiOutputLogMessageColumns& Columns = BlockColumns[BlockIndex];
+		Columns.Reserve(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const int64 TextLen = LengthReader.ReadVarint();
+			if (CategoryIndices[i] >= static_cast<uint32>(Categories.Num())
+				|| Verbosities[i] > static_cast<uint8>(EImGuiLogVerbosity::VeryVerbose)
+				|| BlockEnd - Text < TextLen + 1)
+			{
+				bFailed = true;
+				return;
+			}
+
+			Columns.Add(reinterpret_cast<const char*>(Text), TextLen, CategoryIndices[i],
+				static_cast<EImGuiLogVerbosity>(Verbosities[i]), Timestamps[i], Frames[i]);
+
+			// Skip the '\0' as well
+			Text += TextLen + 1;
+		}
+	});
+
+	if (bFailed)
+	{
+		return false;
+	}
+
+	OutColumns.Reserve(OutColumns.Num() + static_cast<int32>(TotalMessagesNum));
+	for (FImGuiOutputLogMessageColumns& Columns : BlockColumns)
+	{
+		OutColumns.Append(MoveTemp(Columns));
+	}
+
+	return true;
+}
+
+const TArray<char*>& FImGuiOutputLogCapture::GetCategories() const
+{
+	return Categories;
+}
+
+bool FImGuiOutputLogCapture::IsCaptureFile(const FString& Filename)
+{
+	return FPaths::GetExtension(Filename) == GetExtension();
+}
+
+const TCHAR* FImGuiOutputLogCapture::GetExtension()
+{
+	return TEXT("imguilog");
+}
@@ -0,0 +1,93 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+struct FImGuiOutputLogMessageColumns;
+
+/**
+ * Compact binary capture of a log session. Unlike the text formats, it keeps the category, verbosity and timestamp of
+ * every message exactly as they were, and it loads without parsing any text.
+ *
+ * Layout, little endian:
+ *   Blocks       LZ4-compressed, each holding up to ~64 KB of text and the rest of its messages
+ *   Categories   varint count, then every category as a varint length followed by its characters
+ *   Block index  per block: uint64 offset, uint32 compressed size, uint32 uncompressed size, uint32 messages num,
+ *                int64 timestamp of its first message in ticks
+ *   Footer       uint64 categories offset, uint64 block index offset, uint32 blocks num, uint64 messages num,
+ *                uint32 version, uint32 magic
+ *
+ * Before compression a block is laid out in columns: varint category indices, verbosity bytes, zigzag varint
+ * timestamp deltas in ticks, zigzag varint frame deltas starting from 0 (since version 2), varint text lengths, and the
+ * texts, each followed by a '\0'.
+ */
+class FImGuiOutputLogCaptureWriter
+{
+public:
+	using FWriteFunction = TFunction<void(const uint8* Data, int32 Len)>;
+
+public:
+	explicit FImGuiOutputLogCaptureWriter(FWriteFunction InWrite);
+
+	void Add(const ImGui::Private::TMessage& Message);
+	void Finish();
+
+	int64 GetWrittenSize() const;
+	int64 GetRawLogSize() const;
+
+private:
+	struct FBlock
+	{
+	public:
+		uint64 Offset = 0;
+		uint32 CompressedSize = 0;
+		uint32 UncompressedSize = 0;
+		uint32 MessagesNum = 0;
+		int64 FirstTimestamp = 0;
+	};
+
+	void FlushBlock();
+	void Emit(const void* Data, int32 Len);
+
+private:
+	FWriteFunction Write;
+	int64 WrittenSize = 0;
+	int64 RawLogSize = 0;
+	uint64 MessagesNum = 0;
+
+	TMap<FName, int32> CategoryIndices;
+	TArray<FName> Categories;
+
+	TArray<FBlock> Blocks;
+	TArray<uint8> CategoryColumn;
+	TArray<uint8> VerbosityColumn;
+	TArray<uint8> TimestampColumn;
+	TArray<uint8> FrameColumn;
+	TArray<uint8> LengthColumn;
+	TArray<uint8> TextColumn;
+	int64 BlockFirstTimestamp = 0;
+	int64 PreviousTimestamp = 0;
+	uint64 PreviousFrame = 0;
+};
+
+/**
+ * Capture loaded from disk. The messages point into the decompressed blocks and at the categories, so they're only
+ * valid for as long as this object is alive.
+ */
+class FImGuiOutputLogCapture
+{
+public:
+	~FImGuiOutputLogCapture();
+
+	bool Load(const FString& Filename, FImGuiOutputLogMessageColumns& OutColumns);
+
+	const TArray<char*>& GetCategories() const;
+
+	static bool IsCaptureFile(const FString& Filename);
+	static const TCHAR* GetExtension();
+
+private:
+	TArray<TArray<uint8>> Blocks;
+	TArray<char*> Categories;
+};
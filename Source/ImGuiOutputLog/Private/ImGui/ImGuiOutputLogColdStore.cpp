@@ -0,0 +1,144 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogColdStore.h"
+
+#include "ImGuiOutputLogStats.h"
+#include "Misc/Compression.h"
+
+// Enough to cover everything visible on screen plus the block being filtered or exported on each worker
+static constexpr int32 CacheSize = 16;
+
+FImGuiOutputLogColdStore& FImGuiOutputLogColdStore::Get()
+{
+	static FImGuiOutputLogColdStore Instance;
+	return Instance;
+}
+
+void FImGuiOutputLogColdStore::Freeze(TConstArrayView<ImGui::Private::TMessageRef> Messages)
+{
+	check(IsInGameThread());
+	check(!HasReaders());
+
+	TArray<char> Uncompressed;
+	TArray<int32> Offsets;
+	Offsets.Reserve(Messages.Num());
+
+	for (const auto& Message : Messages)
+	{
+		check(Message->Text && Message->bOwnsStrings);
+
+		Offsets.Add(Uncompressed.Num());
+		Uncompressed.Append(Message->Text, Message->TextLen);
+		Uncompressed.Add('\0');
+	}
+
+	auto Block = MakeShared<FImGuiOutputLogColdBlock, ESPMode::ThreadSafe>();
+	Block->Id = NextBlockId++;
+	Block->UncompressedSize = Uncompressed.Num();
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Uncompressed.Num());
+	Block->Compressed.SetNumUninitialized(CompressedSize);
+	verify(FCompression::CompressMemory(NAME_LZ4, Block->Compressed.GetData(), CompressedSize,
+		Uncompressed.GetData(), Uncompressed.Num()));
+	Block->Compressed.SetNum(CompressedSize, EAllowShrinking::Yes);
+
+	// The compressed block is what's stored from now on
+	DEC_MEMORY_STAT_BY(STAT_ImGuiOutputLog_StoredBytes, Uncompressed.Num());
+	INC_MEMORY_STAT_BY(STAT_ImGuiOutputLog_StoredBytes, CompressedSize);
+
+	for (int32 i = 0; i < Messages.Num(); ++i)
+	{
+		const auto& Message = Messages[i];
+		free(Message->Text);
+		Message->Text = nullptr;
+		Message->ColdBlock = Block;
+		Message->ColdOffset = Offsets[i];
+	}
+
+	FScopeLock Lock(&StatsCriticalSection);
+	Stats.ColdMessagesNum += Messages.Num();
+	Stats.ColdBlocksNum++;
+	Stats.CompressedBytes += CompressedSize;
+	Stats.UncompressedBytes += Uncompressed.Num();
+}
+
+FImGuiOutputLogText FImGuiOutputLogColdStore::Thaw(
+	const TSharedPtr<FImGuiOutputLogColdBlock, ESPMode::ThreadSafe>& Block)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	FImGuiOutputLogText Result;
+
+	{
+		FScopeLock Lock(&CacheCriticalSection);
+
+		const int32 Index = Cache.IndexOfByPredicate([&Block](const FCacheEntry& Entry)
+		{
+			return Entry.BlockId == Block->Id;
+		});
+
+		if (Index != INDEX_NONE)
+		{
+			// Most recently used go to the back
+			FCacheEntry Entry = MoveTemp(Cache[Index]);
+			Cache.RemoveAt(Index, EAllowShrinking::No);
+			Result.Pin = Entry.Text;
+			Cache.Add(MoveTemp(Entry));
+		}
+	}
+
+	if (!Result.Pin)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Decompressed outside of the lock; two threads missing on the same block at once only waste a bit of work
+		auto Text = MakeShared<TArray<char>, ESPMode::ThreadSafe>();
+		Text->SetNumUninitialized(Block->UncompressedSize);
+		verify(FCompression::UncompressMemory(NAME_LZ4, Text->GetData(), Block->UncompressedSize,
+			Block->Compressed.GetData(), Block->Compressed.Num()));
+
+		Result.Pin = Text;
+
+		{
+			FScopeLock Lock(&CacheCriticalSection);
+			if (Cache.Num() >= CacheSize)
+			{
+				Cache.RemoveAt(0, EAllowShrinking::No);
+			}
+
+			Cache.Add({ Block->Id, MoveTemp(Text) });
+		}
+
+		FScopeLock Lock(&StatsCriticalSection);
+		Stats.CacheMissesNum++;
+		Stats.LastDecompressionTime = FPlatformTime::Seconds() - StartTime;
+	}
+
+	return Result;
+}
+
+void FImGuiOutputLogColdStore::AddReader()
+{
+	++ReadersNum;
+}
+
+void FImGuiOutputLogColdStore::RemoveReader()
+{
+	--ReadersNum;
+}
+
+bool FImGuiOutputLogColdStore::HasReaders() const
+{
+	return ReadersNum > 0 || !HotTextsPin.IsUnique();
+}
+
+TSharedPtr<const TArray<char>, ESPMode::ThreadSafe> FImGuiOutputLogColdStore::PinHotTexts() const
+{
+	return HotTextsPin;
+}
+
+FImGuiOutputLogColdStore::FStats FImGuiOutputLogColdStore::GetStats() const
+{
+	FScopeLock Lock(&StatsCriticalSection);
+	return Stats;
+}
@@ -0,0 +1,80 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+#include <atomic>
+
+/** Texts of a batch of old messages, compressed together. */
+struct FImGuiOutputLogColdBlock
+{
+public:
+	uint64 Id = 0;
+	TArray<uint8> Compressed;
+	int32 UncompressedSize = 0;
+};
+
+/**
+ * Cold tier of the log. Old messages keep their metadata, but their texts are moved into LZ4-compressed blocks of
+ * ~64 KB, and are decompressed on demand through a small LRU cache of blocks.
+ *
+ * The texts of hot messages are freed when they're moved, so threads other than the game thread that read texts
+ * must be registered as readers for as long as they do; nothing is moved while there are any. Texts read on the game
+ * thread are pinned instead, as anything it logs while using them may move them.
+ */
+class FImGuiOutputLogColdStore
+{
+public:
+	struct FStats
+	{
+	public:
+		int64 ColdMessagesNum = 0;
+		int64 ColdBlocksNum = 0;
+		int64 CompressedBytes = 0;
+		int64 UncompressedBytes = 0;
+		int64 CacheMissesNum = 0;
+		double LastDecompressionTime = 0.0;
+	};
+
+public:
+	static FImGuiOutputLogColdStore& Get();
+
+	/** Moves the texts of the messages into a single block. Game thread only. */
+	void Freeze(TConstArrayView<ImGui::Private::TMessageRef> Messages);
+	FImGuiOutputLogText Thaw(const TSharedPtr<FImGuiOutputLogColdBlock, ESPMode::ThreadSafe>& Block);
+
+	void AddReader();
+	void RemoveReader();
+
+	/** Whether there are readers, or hot texts pinned on the game thread. */
+	bool HasReaders() const;
+
+	/** Keeps the texts of hot messages from being moved while the returned pin is alive. Game thread only. */
+	TSharedPtr<const TArray<char>, ESPMode::ThreadSafe> PinHotTexts() const;
+
+	FStats GetStats() const;
+
+	static constexpr int32 BlockSize = 64 * 1024;
+
+private:
+	struct FCacheEntry
+	{
+	public:
+		uint64 BlockId = 0;
+		TSharedPtr<const TArray<char>, ESPMode::ThreadSafe> Text;
+	};
+
+private:
+	std::atomic<int32> ReadersNum = 0;
+
+	// Shared by every pinned hot text; there are none as long as this is the only reference
+	TSharedPtr<const TArray<char>, ESPMode::ThreadSafe> HotTextsPin = MakeShared<TArray<char>, ESPMode::ThreadSafe>();
+	uint64 NextBlockId = 1;
+
+	mutable FCriticalSection CacheCriticalSection;
+	TArray<FCacheEntry> Cache;
+
+	mutable FCriticalSection StatsCriticalSection;
+	FStats Stats;
+};
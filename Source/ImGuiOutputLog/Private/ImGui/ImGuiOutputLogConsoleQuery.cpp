@@ -0,0 +1,459 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "imgui_internal.h"
+#include "ImGui/ImGuiOutputLogBuffer.h"
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGui/ImGuiOutputLogDeadline.h"
+#include "ImGui/ImGuiOutputLogExporter.h"
+#include "ImGui/ImGuiOutputLogFilter.h"
+#include "ImGuiOutputLogStats.h"
+#include "Misc/Paths.h"
+
+// Results are printed into a category of their own, so that queries can tell them apart from what they go through
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiOutputLogQuery, Log, All);
+
+// Time all the running queries get per frame, so that going through millions of messages doesn't stall the server
+static constexpr double QueryBudget = 0.002;
+
+static constexpr int32 DefaultTailNum = 20;
+static constexpr int32 StatsTopCategoriesNum = 10;
+
+/** Search over the messages of the log buffer, going through them a slice per frame. */
+class FImGuiOutputLogConsoleQuery
+{
+public:
+	enum class EType : uint8
+	{
+		Grep,
+		Tail,
+		Stats,
+		Export,
+	};
+
+public:
+	FImGuiOutputLogConsoleQuery(EType InType, const FString& InQuery);
+
+	/** Returns false once there's nothing left to do. */
+	bool Tick(double Deadline);
+
+public:
+	// Tail only; how many of the last messages to print, and whether to keep printing the new ones afterward
+	int32 TailNum = DefaultTailNum;
+	bool bFollow = false;
+
+	// Export only
+	FString Filename;
+
+private:
+	bool PassFilter(const ImGui::Private::TMessageRef& Message);
+	void Print(const ImGui::Private::TMessage& Message) const;
+	void PrintStats() const;
+	void Finish();
+
+	static EImGuiOutputLogExportFormat GetFormat(const FString& Filename);
+
+private:
+	EType Type = EType::Grep;
+	FString Query;
+	FImGuiOutputLogFilter Filter;
+
+	// Categories that have been looked at, and the ones that hold the results of queries
+	TBitArray<> CheckedCategories;
+	TBitArray<> SkippedCategories;
+
+	// Messages past the end are the ones logged after the query started, which only tail -follow goes through
+	int32 Begin = 0;
+	int32 End = 0;
+	int32 Next = 0;
+
+	int32 PassedNum = 0;
+	double StartTime = 0.0;
+
+	// Tail goes from the end back, and prints what it found once it has enough
+	TArray<ImGui::Private::TMessageRef> Found;
+
+	// Stats
+	int32 VerbositiesNum[static_cast<int32>(EImGuiLogVerbosity::VeryVerbose) + 1] = {};
+	TMap<int32, int32> CategoriesNum;
+	TMap<int32, const char*> CategoryNames;
+	int32 LinesNum = 0;
+	int64 TextBytes = 0;
+
+	TUniquePtr<FImGuiOutputLogExporter> Exporter;
+	bool bIsFiltering = true;
+};
+
+static TArray<TUniquePtr<FImGuiOutputLogConsoleQuery>> RunningQueries;
+static FTSTicker::FDelegateHandle RunningQueriesTicker;
+
+static UImGuiOutputLogBuffer* GetLogBuffer()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UImGuiOutputLogBuffer>() : nullptr;
+}
+
+FImGuiOutputLogConsoleQuery::FImGuiOutputLogConsoleQuery(EType InType, const FString& InQuery)
+	: Type(InType)
+	, Query(InQuery)
+{
+	Filter.SetQuery(TCHAR_TO_ANSI(*Query));
+
+	End = GetLogBuffer()->Messages.Num();
+	Next = Type == EType::Tail ? End - 1 : 0;
+	StartTime = FPlatformTime::Seconds();
+}
+
+bool FImGuiOutputLogConsoleQuery::Tick(double Deadline)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	const UImGuiOutputLogBuffer* LogBuffer = GetLogBuffer();
+	if (!LogBuffer)
+	{
+		return false;
+	}
+
+	if (Exporter)
+	{
+		if (Exporter->IsRunning())
+		{
+			return true;
+		}
+
+		static const TCHAR* ResultNames[] = { TEXT("none"), TEXT("succeeded"), TEXT("failed"), TEXT("cancelled") };
+		UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("Export of %d messages to %s %s"), PassedNum,
+			*Exporter->GetFilename(), ResultNames[static_cast<int32>(Exporter->GetResult())]);
+		return false;
+	}
+
+	const TArray<ImGui::Private::TMessageRef>& Messages = LogBuffer->Messages;
+	int32 Checked = 0;
+	if (bIsFiltering && Type == EType::Tail)
+	{
+		for (; Next >= Begin && Found.Num() < TailNum; --Next)
+		{
+			if (PassFilter(Messages[Next]))
+			{
+				Found.Add(Messages[Next]);
+			}
+
+			if (IsPastDeadline(++Checked, Deadline))
+			{
+				return true;
+			}
+		}
+
+		for (int32 i = Found.Num() - 1; i >= 0; --i)
+		{
+			Print(*Found[i]);
+		}
+
+		Found.Empty();
+		Next = End;
+		bIsFiltering = false;
+	}
+	else if (bIsFiltering)
+	{
+		for (; Next < End; ++Next)
+		{
+			const ImGui::Private::TMessageRef& Message = Messages[Next];
+			if (PassFilter(Message))
+			{
+				++PassedNum;
+				switch (Type)
+				{
+				case EType::Grep:
+					Print(*Message);
+					break;
+				case EType::Stats:
+					++VerbositiesNum[static_cast<int32>(Message->Verbosity)];
+					++CategoriesNum.FindOrAdd(Message->CategoryIndex);
+					CategoryNames.FindOrAdd(Message->CategoryIndex, Message->Category);
+					LinesNum += Message->GetLinesNum();
+					TextBytes += Message->TextLen;
+					break;
+				case EType::Export:
+					Found.Add(Message);
+					break;
+				default:
+					break;
+				}
+			}
+
+			if (IsPastDeadline(++Checked, Deadline))
+			{
+				return true;
+			}
+		}
+
+		Finish();
+		bIsFiltering = false;
+		return Exporter.IsValid();
+	}
+
+	if (!bFollow)
+	{
+		return false;
+	}
+
+	// New messages are printed as they come, for as long as the query isn't cancelled
+	for (; Next < Messages.Num(); ++Next)
+	{
+		if (PassFilter(Messages[Next]))
+		{
+			Print(*Messages[Next]);
+		}
+	}
+
+	return true;
+}
+
+bool FImGuiOutputLogConsoleQuery::PassFilter(const ImGui::Private::TMessageRef& Message)
+{
+	const int32 CategoryIndex = Message->CategoryIndex;
+	if (CategoryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	if (CategoryIndex >= CheckedCategories.Num())
+	{
+		CheckedCategories.Add(false, CategoryIndex + 1 - CheckedCategories.Num());
+		SkippedCategories.Add(false, CategoryIndex + 1 - SkippedCategories.Num());
+	}
+
+	if (!CheckedCategories[CategoryIndex])
+	{
+		CheckedCategories[CategoryIndex] = true;
+		SkippedCategories[CategoryIndex] = FCStringAnsi::Strcmp(Message->Category, "LogImGuiOutputLogQuery") == 0;
+
+		// The filter only lets the categories it knows about through
+		Filter.Context.AddCategoryOf(*Message);
+	}
+
+	return !SkippedCategories[CategoryIndex] && Filter.PassFilter(Message);
+}
+
+void FImGuiOutputLogConsoleQuery::Print(const ImGui::Private::TMessage& Message) const
+{
+	char Timestamp[32];
+	Message.FormatTimestamp(Timestamp, sizeof(Timestamp));
+
+	// Same layout as the engine's own log files
+	const FImGuiOutputLogText Text = Message.GetText();
+	UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("[%s][%3llu]%s: %s: %s"), ANSI_TO_TCHAR(Timestamp),
+		static_cast<unsigned long long>(Message.Frame % 1000), ANSI_TO_TCHAR(Message.Category),
+		ANSI_TO_TCHAR(ImGui::Private::TMessage::VerbosityToString(Message.Verbosity)),
+		*FString(static_cast<int32>(Text.End - Text.Begin), Text.Begin));
+}
+
+void FImGuiOutputLogConsoleQuery::PrintStats() const
+{
+	UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("%d of %d messages, %d lines, %lld bytes of text"), PassedNum,
+		End - Begin, LinesNum, TextBytes);
+
+	for (const auto Verbosity : TEnumRange<EImGuiLogVerbosity>())
+	{
+		if (const int32 Num = VerbositiesNum[static_cast<int32>(Verbosity)])
+		{
+			UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("  %-14s %d"),
+				ANSI_TO_TCHAR(ImGui::Private::TMessage::VerbosityToString(Verbosity)), Num);
+		}
+	}
+
+	TArray<TPair<int32, int32>> Categories = CategoriesNum.Array();
+	Categories.Sort([](const TPair<int32, int32>& Lhs, const TPair<int32, int32>& Rhs)
+	{
+		return Lhs.Value > Rhs.Value;
+	});
+
+	for (int32 i = 0; i < FMath::Min(Categories.Num(), StatsTopCategoriesNum); ++i)
+	{
+		UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("  %-32s %d"), ANSI_TO_TCHAR(CategoryNames[Categories[i].Key]),
+			Categories[i].Value);
+	}
+
+	const FImGuiOutputLogColdStore::FStats ColdStats = FImGuiOutputLogColdStore::Get().GetStats();
+	UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("Cold tier: %lld messages in %lld blocks, %lld of %lld bytes"),
+		ColdStats.ColdMessagesNum, ColdStats.ColdBlocksNum, ColdStats.CompressedBytes, ColdStats.UncompressedBytes);
+}
+
+void FImGuiOutputLogConsoleQuery::Finish()
+{
+	const double Time = FPlatformTime::Seconds() - StartTime;
+	switch (Type)
+	{
+	case EType::Grep:
+		UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("%d of %d messages matched \"%s\" in %.2f s"), PassedNum,
+			End - Begin, *Query, Time);
+		break;
+	case EType::Stats:
+		PrintStats();
+		break;
+	case EType::Export:
+		Exporter = MakeUnique<FImGuiOutputLogExporter>();
+		if (!Exporter->Start(Filename, GetFormat(Filename), MoveTemp(Found)))
+		{
+			UE_LOG(LogImGuiOutputLogQuery, Warning, TEXT("Failed to open %s"), *Filename);
+			Exporter.Reset();
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+EImGuiOutputLogExportFormat FImGuiOutputLogConsoleQuery::GetFormat(const FString& Filename)
+{
+	const FString Extension = FPaths::GetExtension(Filename);
+	for (const auto Format : { EImGuiOutputLogExportFormat::NDJson, EImGuiOutputLogExportFormat::Csv,
+		EImGuiOutputLogExportFormat::Capture })
+	{
+		if (Extension == FImGuiOutputLogExporter::GetExtension(Format))
+		{
+			return Format;
+		}
+	}
+
+	return EImGuiOutputLogExportFormat::PlainText;
+}
+
+static bool TickRunningQueries(float DeltaTime)
+{
+	const double Deadline = FPlatformTime::Seconds() + QueryBudget;
+	for (int32 i = 0; i < RunningQueries.Num(); ++i)
+	{
+		if (!RunningQueries[i]->Tick(Deadline))
+		{
+			RunningQueries.RemoveAt(i--);
+		}
+	}
+
+	if (RunningQueries.IsEmpty())
+	{
+		RunningQueriesTicker.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+static void RunQuery(TUniquePtr<FImGuiOutputLogConsoleQuery>&& Query)
+{
+	RunningQueries.Add(MoveTemp(Query));
+	if (!RunningQueriesTicker.IsValid())
+	{
+		RunningQueriesTicker = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateStatic(&TickRunningQueries));
+	}
+}
+
+static FString JoinArgs(const TArray<FString>& Args, int32 First)
+{
+	FString Result;
+	for (int32 i = First; i < Args.Num(); ++i)
+	{
+		Result += Result.IsEmpty() ? Args[i] : TEXT(" ") + Args[i];
+	}
+
+	return Result;
+}
+
+static void Grep(const TArray<FString>& Args)
+{
+	if (GetLogBuffer())
+	{
+		RunQuery(MakeUnique<FImGuiOutputLogConsoleQuery>(FImGuiOutputLogConsoleQuery::EType::Grep, JoinArgs(Args, 0)));
+	}
+}
+
+static void Tail(const TArray<FString>& Args)
+{
+	if (!GetLogBuffer())
+	{
+		return;
+	}
+
+	TArray<FString> QueryArgs = Args;
+	const bool bFollow = QueryArgs.Remove(TEXT("-follow")) > 0;
+
+	int32 TailNum = DefaultTailNum;
+	if (QueryArgs.Num() > 0 && QueryArgs[0].IsNumeric())
+	{
+		TailNum = FMath::Max(0, FCString::Atoi(*QueryArgs[0]));
+		QueryArgs.RemoveAt(0);
+	}
+
+	auto Query = MakeUnique<FImGuiOutputLogConsoleQuery>(FImGuiOutputLogConsoleQuery::EType::Tail,
+		JoinArgs(QueryArgs, 0));
+	Query->TailNum = TailNum;
+	Query->bFollow = bFollow;
+	RunQuery(MoveTemp(Query));
+}
+
+static void Stats(const TArray<FString>& Args)
+{
+	if (GetLogBuffer())
+	{
+		RunQuery(MakeUnique<FImGuiOutputLogConsoleQuery>(FImGuiOutputLogConsoleQuery::EType::Stats, JoinArgs(Args, 0)));
+	}
+}
+
+static void Export(const TArray<FString>& Args)
+{
+	if (!GetLogBuffer() || Args.IsEmpty())
+	{
+		UE_LOG(LogImGuiOutputLogQuery, Warning, TEXT("Usage: imguilog.export <Filename> [Query]"));
+		return;
+	}
+
+	// Relative paths are relative to the log directory, which is where the exports from the window go as well
+	auto Query = MakeUnique<FImGuiOutputLogConsoleQuery>(FImGuiOutputLogConsoleQuery::EType::Export,
+		JoinArgs(Args, 1));
+	Query->Filename = FPaths::IsRelative(Args[0])
+		? FPaths::ConvertRelativePathToFull(FPaths::ProjectLogDir() / Args[0])
+		: Args[0];
+	RunQuery(MoveTemp(Query));
+}
+
+static void Cancel(const TArray<FString>& Args)
+{
+	UE_LOG(LogImGuiOutputLogQuery, Display, TEXT("Cancelled %d queries"), RunningQueries.Num());
+
+	// Exporters wait for their task when destroyed, which is quick once cancelled
+	RunningQueries.Empty();
+	if (RunningQueriesTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RunningQueriesTicker);
+		RunningQueriesTicker.Reset();
+	}
+}
+
+static FAutoConsoleCommand GrepCommand(
+	TEXT("imguilog.grep"),
+	TEXT("Prints the messages that match the query, written as in the search box. Usage: imguilog.grep <Query>"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Grep));
+
+static FAutoConsoleCommand TailCommand(
+	TEXT("imguilog.tail"),
+	TEXT("Prints the last messages that match the query, and with -follow the new ones as they come until ")
+	TEXT("imguilog.cancel. Usage: imguilog.tail [Num=20] [-follow] [Query]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Tail));
+
+static FAutoConsoleCommand StatsCommand(
+	TEXT("imguilog.stats"),
+	TEXT("Prints how many messages match the query per verbosity and category. Usage: imguilog.stats [Query]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Stats));
+
+static FAutoConsoleCommand ExportCommand(
+	TEXT("imguilog.export"),
+	TEXT("Exports the messages that match the query; the format follows the extension, plain text by default. ")
+	TEXT("Usage: imguilog.export <Filename> [Query]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Export));
+
+static FAutoConsoleCommand CancelCommand(
+	TEXT("imguilog.cancel"),
+	TEXT("Stops all the running imguilog queries."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&Cancel));
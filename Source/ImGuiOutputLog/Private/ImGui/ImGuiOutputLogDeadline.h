@@ -0,0 +1,12 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+// Reading the clock for every message would cost more than some of the messages themselves
+inline constexpr int32 DeadlineCheckInterval = 64;
+
+/** Whether the deadline has passed, looking at the clock only once every DeadlineCheckInterval items done. */
+inline bool IsPastDeadline(int32 DoneNum, double Deadline)
+{
+	return DoneNum % DeadlineCheckInterval == 0 && FPlatformTime::Seconds() >= Deadline;
+}
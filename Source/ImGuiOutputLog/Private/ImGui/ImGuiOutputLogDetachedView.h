@@ -0,0 +1,45 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "Templates/UniquePtr.h"
+
+class FImGuiEngineLogImpl;
+class UImGuiOutputLogBuffer;
+struct ImGuiContext;
+
+/**
+ * Log window over a detached buffer, drawn into an ImGui context of its own rather than through the ImGui module and a
+ * game instance, e.g. by the benchmark suite when running headless. Nothing is rendered, but everything the window does
+ * on screen is done: filtering, formatting, the clipper, the minimap and the selection.
+ */
+class FImGuiOutputLogDetachedView
+{
+public:
+	explicit FImGuiOutputLogDetachedView(UImGuiOutputLogBuffer* LogBuffer);
+	~FImGuiOutputLogDetachedView();
+
+	/** Draws a frame of the window, scrolled to the displayed line first unless it's INDEX_NONE. */
+	void Tick(int32 TopLine = INDEX_NONE);
+
+	/** Filters the whole store by the query right away, rather than within the budget of a frame. */
+	void SetQuery(const char* Query);
+
+	void SetDisplayedElements(int32 Elements);
+	void SetWrapLines(bool bWrapLines);
+	void SelectAll();
+	int32 GetLinesNum() const;
+
+	/** Formats the prefix of every message of the store as the window does; returns how many bytes that took. */
+	int64 FormatAllPrefixes() const;
+
+	/**
+	 * Opens the file as Open Log File... does, and draws the window until its first screen is up, which logs how long
+	 * that took and the peak RSS. Returns false if the file couldn't be opened.
+	 */
+	bool OpenFile(const FString& Filename, double& OutParseTime);
+
+private:
+	TUniquePtr<FImGuiEngineLogImpl> Impl;
+	ImGuiContext* Context = nullptr;
+};
@@ -0,0 +1,338 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogExporter.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "ImGuiOutputLog.h"
+#include "ImGui/ImGuiOutputLogCapture.h"
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGuiOutputLogStats.h"
+#include "Misc/Paths.h"
+
+static constexpr int32 WriteBufferSize = 64 * 1024;
+
+static const char* VerbosityToName(EImGuiLogVerbosity Verbosity)
+{
+	// Same names the engine writes into its own log files
+	switch (Verbosity)
+	{
+	case EImGuiLogVerbosity::Verbose: return "Verbose";
+	case EImGuiLogVerbosity::VeryVerbose: return "VeryVerbose";
+	case EImGuiLogVerbosity::Log: return "Log";
+	case EImGuiLogVerbosity::Display: return "Display";
+	case EImGuiLogVerbosity::Warning: return "Warning";
+	case EImGuiLogVerbosity::Error: return "Error";
+	case EImGuiLogVerbosity::Fatal: return "Fatal";
+	default: return "Invalid";
+	}
+}
+
+FImGuiOutputLogExporter::~FImGuiOutputLogExporter()
+{
+	Cancel();
+	Task.Wait();
+}
+
+bool FImGuiOutputLogExporter::Start(const FString& InFilename, EImGuiOutputLogExportFormat InFormat,
+	TArray<ImGui::Private::TMessageRef>&& InMessages)
+{
+	const int32 Num = InMessages.Num();
+	return Start(InFilename, InFormat, Num, [Messages = MoveTemp(InMessages)](int32 Index)
+	{
+		return Messages[Index];
+	});
+}
+
+bool FImGuiOutputLogExporter::Start(const FString& InFilename, EImGuiOutputLogExportFormat InFormat,
+	int32 InMessagesNum, FMessageAtFunction InMessageAt)
+{
+	if (IsRunning())
+	{
+		return false;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(InFilename));
+
+	Filename = InFilename;
+	FileHandle.Reset(PlatformFile.OpenWrite(*Filename));
+	if (!FileHandle)
+	{
+		Result = EResult::Failed;
+		return false;
+	}
+
+	Format = InFormat;
+	MessageAt = MoveTemp(InMessageAt);
+	MessagesNum = InMessagesNum;
+	ExportedNum = 0;
+	bCancelRequested = false;
+	Result = EResult::None;
+
+	// Registered here rather than on the task, so that nothing can be moved to the cold tier in between
+	FImGuiOutputLogColdStore::Get().AddReader();
+
+	Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]
+	{
+		LLM_SCOPE_BYTAG(ImGuiOutputLog);
+		Run();
+		FImGuiOutputLogColdStore::Get().RemoveReader();
+	}, UE::Tasks::ETaskPriority::BackgroundNormal);
+
+	return true;
+}
+
+void FImGuiOutputLogExporter::Cancel()
+{
+	bCancelRequested = true;
+}
+
+void FImGuiOutputLogExporter::Wait()
+{
+	Task.Wait();
+}
+
+bool FImGuiOutputLogExporter::IsRunning() const
+{
+	return !Task.IsCompleted();
+}
+
+float FImGuiOutputLogExporter::GetProgress() const
+{
+	return MessagesNum > 0 ? static_cast<float>(ExportedNum) / MessagesNum : 1.f;
+}
+
+FImGuiOutputLogExporter::EResult FImGuiOutputLogExporter::GetResult() const
+{
+	return IsRunning() ? EResult::None : Result;
+}
+
+const FString& FImGuiOutputLogExporter::GetFilename() const
+{
+	return Filename;
+}
+
+const TCHAR* FImGuiOutputLogExporter::GetExtension(EImGuiOutputLogExportFormat Format)
+{
+	switch (Format)
+	{
+	case EImGuiOutputLogExportFormat::PlainText: return TEXT("log");
+	case EImGuiOutputLogExportFormat::NDJson: return TEXT("ndjson");
+	case EImGuiOutputLogExportFormat::Csv: return TEXT("csv");
+	case EImGuiOutputLogExportFormat::Capture: return FImGuiOutputLogCapture::GetExtension();
+	default: return TEXT("txt");
+	}
+}
+
+void FImGuiOutputLogExporter::Run()
+{
+	WriteBuffer.Reset(WriteBufferSize);
+	bWriteFailed = false;
+
+	if (Format == EImGuiOutputLogExportFormat::Capture)
+	{
+		RunCapture();
+	}
+	else
+	{
+		if (Format == EImGuiOutputLogExportFormat::Csv)
+		{
+			static constexpr char Header[] = "Timestamp,Category,Verbosity,Text\n";
+			Write(Header, sizeof(Header) - 1);
+		}
+
+		for (int32 i = 0; i < MessagesNum; ++i)
+		{
+			if (bCancelRequested || bWriteFailed)
+			{
+				break;
+			}
+
+			WriteMessage(*MessageAt(i));
+			++ExportedNum;
+		}
+	}
+
+	Flush();
+	FileHandle.Reset();
+	MessageAt = nullptr;
+
+	if (bCancelRequested || bWriteFailed)
+	{
+		// A partial export is more confusing than no export at all
+		FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*Filename);
+		Result = bWriteFailed ? EResult::Failed : EResult::Cancelled;
+	}
+	else
+	{
+		Result = EResult::Succeeded;
+	}
+}
+
+void FImGuiOutputLogExporter::RunCapture()
+{
+	FImGuiOutputLogCaptureWriter Writer([this](const uint8* Data, int32 Len)
+	{
+		Write(reinterpret_cast<const char*>(Data), Len);
+	});
+
+	for (int32 i = 0; i < MessagesNum; ++i)
+	{
+		if (bCancelRequested || bWriteFailed)
+		{
+			return;
+		}
+
+		Writer.Add(*MessageAt(i));
+		++ExportedNum;
+	}
+
+	Writer.Finish();
+
+	UE_LOG(LogImGuiOutputLog, Display, TEXT("Captured %d messages into %s: %.2f MB, %.1f%% of the same log as text"),
+		MessagesNum, *Filename, Writer.GetWrittenSize() / (1024.0 * 1024.0),
+		Writer.GetRawLogSize() > 0 ? 100.0 * Writer.GetWrittenSize() / Writer.GetRawLogSize() : 0.0);
+}
+
+void FImGuiOutputLogExporter::WriteMessage(const ImGui::Private::TMessage& Message)
+{
+	char Timestamp[32];
+	const int32 TimestampLen = Message.FormatTimestamp(Timestamp, sizeof(Timestamp));
+
+	const char* Verbosity = VerbosityToName(Message.Verbosity);
+	const int32 VerbosityLen = FCStringAnsi::Strlen(Verbosity);
+
+	const FImGuiOutputLogText Text = Message.GetText();
+
+	switch (Format)
+	{
+	case EImGuiOutputLogExportFormat::PlainText:
+	{
+		// [Timestamp]Category: Verbosity: Text, the same way the engine writes its log files
+		Write("[", 1);
+		Write(Timestamp, TimestampLen);
+		Write("]", 1);
+		Write(Message.Category, Message.CategoryLen);
+		Write(": ", 2);
+		if (Message.Verbosity != EImGuiLogVerbosity::Log)
+		{
+			Write(Verbosity, VerbosityLen);
+			Write(": ", 2);
+		}
+		Write(Text.Begin, Message.TextLen);
+		Write("\n", 1);
+		break;
+	}
+	case EImGuiOutputLogExportFormat::NDJson:
+	{
+		Write("{\"timestamp\":", 13);
+		WriteJsonString(Timestamp, TimestampLen);
+		Write(",\"category\":", 12);
+		WriteJsonString(Message.Category, Message.CategoryLen);
+		Write(",\"verbosity\":", 13);
+		WriteJsonString(Verbosity, VerbosityLen);
+		Write(",\"text\":", 8);
+		WriteJsonString(Text.Begin, Message.TextLen);
+		Write("}\n", 2);
+		break;
+	}
+	case EImGuiOutputLogExportFormat::Csv:
+	{
+		Write(Timestamp, TimestampLen);
+		Write(",", 1);
+		WriteCsvString(Message.Category, Message.CategoryLen);
+		Write(",", 1);
+		Write(Verbosity, VerbosityLen);
+		Write(",", 1);
+		WriteCsvString(Text.Begin, Message.TextLen);
+		Write("\n", 1);
+		break;
+	}
+	default:
+		checkNoEntry();
+	}
+}
+
+void FImGuiOutputLogExporter::WriteJsonString(const char* Text, int32 Len)
+{
+	Write("\"", 1);
+
+	// Write everything that doesn't need escaping in runs instead of char by char
+	const char* RunBegin = Text;
+	const char* End = Text + Len;
+	for (const char* It = Text; It < End; ++It)
+	{
+		const unsigned char Char = *It;
+		if (Char >= 0x20 && Char != '"' && Char != '\\')
+		{
+			continue;
+		}
+
+		Write(RunBegin, It - RunBegin);
+		RunBegin = It + 1;
+
+		switch (Char)
+		{
+		case '"': Write("\\\"", 2); break;
+		case '\\': Write("\\\\", 2); break;
+		case '\n': Write("\\n", 2); break;
+		case '\r': Write("\\r", 2); break;
+		case '\t': Write("\\t", 2); break;
+		default:
+		{
+			char Escaped[8];
+			const int32 EscapedLen = FCStringAnsi::Snprintf(Escaped, sizeof(Escaped), "\\u%04x", Char);
+			Write(Escaped, EscapedLen);
+		}
+		}
+	}
+
+	Write(RunBegin, End - RunBegin);
+	Write("\"", 1);
+}
+
+void FImGuiOutputLogExporter::WriteCsvString(const char* Text, int32 Len)
+{
+	Write("\"", 1);
+
+	// Quotes are escaped by doubling them
+	const char* RunBegin = Text;
+	const char* End = Text + Len;
+	for (const char* It = Text; It < End; ++It)
+	{
+		if (*It == '"')
+		{
+			Write(RunBegin, It - RunBegin + 1);
+			RunBegin = It;
+		}
+	}
+
+	Write(RunBegin, End - RunBegin);
+	Write("\"", 1);
+}
+
+void FImGuiOutputLogExporter::Write(const char* Data, int32 Len)
+{
+	if (WriteBuffer.Num() + Len > WriteBufferSize)
+	{
+		Flush();
+
+		if (Len > WriteBufferSize)
+		{
+			// Doesn't fit anyway, so there's no point in copying it
+			bWriteFailed |= !FileHandle->Write(reinterpret_cast<const uint8*>(Data), Len);
+			return;
+		}
+	}
+
+	WriteBuffer.Append(Data, Len);
+}
+
+void FImGuiOutputLogExporter::Flush()
+{
+	if (WriteBuffer.Num() > 0)
+	{
+		bWriteFailed |= !FileHandle->Write(reinterpret_cast<const uint8*>(WriteBuffer.GetData()), WriteBuffer.Num());
+		WriteBuffer.Reset();
+	}
+}
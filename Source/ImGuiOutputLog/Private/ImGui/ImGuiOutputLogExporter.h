@@ -0,0 +1,82 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessage.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+class IFileHandle;
+
+enum class EImGuiOutputLogExportFormat : uint8
+{
+	PlainText,
+	NDJson,
+	Csv,
+
+	// Binary, lossless, and can be opened again in the log window
+	Capture,
+};
+
+/**
+ * Writes messages to a file on a background task. The text is streamed straight from the messages through a fixed
+ * size buffer, so the size of the export doesn't matter for memory.
+ */
+class FImGuiOutputLogExporter
+{
+public:
+	enum class EResult : uint8
+	{
+		None,
+		Succeeded,
+		Failed,
+		Cancelled,
+	};
+
+public:
+	~FImGuiOutputLogExporter();
+
+	using FMessageAtFunction = TFunction<ImGui::Private::TMessageRef(int32 Index)>;
+
+	bool Start(const FString& InFilename, EImGuiOutputLogExportFormat InFormat,
+		TArray<ImGui::Private::TMessageRef>&& InMessages);
+
+	/** Asks for the messages one at a time on the task, e.g. to make them from the columns of a file as they go. */
+	bool Start(const FString& InFilename, EImGuiOutputLogExportFormat InFormat, int32 InMessagesNum,
+		FMessageAtFunction InMessageAt);
+	void Cancel();
+	void Wait();
+
+	bool IsRunning() const;
+	float GetProgress() const;
+	EResult GetResult() const;
+	const FString& GetFilename() const;
+
+	static const TCHAR* GetExtension(EImGuiOutputLogExportFormat Format);
+
+private:
+	void Run();
+	void RunCapture();
+
+	void WriteMessage(const ImGui::Private::TMessage& Message);
+	void WriteJsonString(const char* Text, int32 Len);
+	void WriteCsvString(const char* Text, int32 Len);
+	void Write(const char* Data, int32 Len);
+	void Flush();
+
+private:
+	FString Filename;
+	EImGuiOutputLogExportFormat Format = EImGuiOutputLogExportFormat::PlainText;
+	FMessageAtFunction MessageAt;
+	int32 MessagesNum = 0;
+
+	TUniquePtr<IFileHandle> FileHandle;
+	TArray<char> WriteBuffer;
+	bool bWriteFailed = false;
+
+	UE::Tasks::FTask Task;
+	std::atomic<int32> ExportedNum = 0;
+	std::atomic<bool> bCancelRequested = false;
+	EResult Result = EResult::None;
+};
@@ -0,0 +1,419 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogFileSource.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "ImGui/ImGuiOutputLogCapture.h"
+#include "ImGui/ImGuiOutputLogSharedRing.h"
+#include "ImGuiOutputLogStats.h"
+
+// Big enough for the per-chunk overhead not to matter, small enough to keep all cores busy on a few hundred MB
+static constexpr int64 ChunkSize = 4 * 1024 * 1024;
+
+struct FImGuiOutputLogFileSource::FChunk
+{
+	FImGuiOutputLogMessageColumns Columns;
+
+	// Lines at the beginning of the chunk that continue the last message of the previous chunk
+	const char* LeadingLinesEnd = nullptr;
+	int32 LeadingLinesNum = 0;
+};
+
+struct FImGuiOutputLogFileSource::FLinePrefix
+{
+	FDateTime Timestamp;
+	uint64 Frame = 0;
+	const char* Category = nullptr;
+	int32 CategoryLen = 0;
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+	const char* Text = nullptr;
+};
+
+static bool ParseNumber(const char*& It, const char* End, int32 Digits, int32& OutValue)
+{
+	OutValue = 0;
+	for (int32 i = 0; i < Digits; ++i, ++It)
+	{
+		if (It >= End || !FCharAnsi::IsDigit(*It))
+		{
+			return false;
+		}
+
+		OutValue = OutValue * 10 + (*It - '0');
+	}
+
+	return true;
+}
+
+static bool ParseTimestamp(const char* It, const char* End, FDateTime& OutTimestamp)
+{
+	// 2025.06.01-12.34.56:789
+	int32 Year, Month, Day, Hour, Minute, Second, Millisecond;
+	const bool bParsed =
+		ParseNumber(It, End, 4, Year) && It < End && *It++ == '.' &&
+		ParseNumber(It, End, 2, Month) && It < End && *It++ == '.' &&
+		ParseNumber(It, End, 2, Day) && It < End && *It++ == '-' &&
+		ParseNumber(It, End, 2, Hour) && It < End && *It++ == '.' &&
+		ParseNumber(It, End, 2, Minute) && It < End && *It++ == '.' &&
+		ParseNumber(It, End, 2, Second) && It < End && *It++ == ':' &&
+		ParseNumber(It, End, 3, Millisecond);
+
+	if (!bParsed || !FDateTime::Validate(Year, Month, Day, Hour, Minute, Second, Millisecond))
+	{
+		return false;
+	}
+
+	OutTimestamp = FDateTime(Year, Month, Day, Hour, Minute, Second, Millisecond);
+	return true;
+}
+
+static bool ParseVerbosity(const char* Begin, const char* End, EImGuiLogVerbosity& OutVerbosity)
+{
+	// Log is the default, and the engine doesn't write it
+	static const TPair<const char*, EImGuiLogVerbosity> Verbosities[] =
+	{
+		{ "Fatal", EImGuiLogVerbosity::Fatal },
+		{ "Error", EImGuiLogVerbosity::Error },
+		{ "Warning", EImGuiLogVerbosity::Warning },
+		{ "Display", EImGuiLogVerbosity::Display },
+		{ "Verbose", EImGuiLogVerbosity::Verbose },
+		{ "VeryVerbose", EImGuiLogVerbosity::VeryVerbose },
+	};
+
+	const int32 Len = End - Begin;
+	for (const auto& [Name, Verbosity] : Verbosities)
+	{
+		if (FCStringAnsi::Strlen(Name) == Len && FCStringAnsi::Strncmp(Name, Begin, Len) == 0)
+		{
+			OutVerbosity = Verbosity;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FImGuiOutputLogFileSource::~FImGuiOutputLogFileSource()
+{
+	// Messages made from the columns must be gone by now; the region has to be unmapped before its file is closed
+	Capture.Reset();
+	MappedRegion.Reset();
+	MappedFile.Reset();
+
+	for (char* Category : Categories)
+	{
+		free(Category);
+	}
+}
+
+bool FImGuiOutputLogFileSource::Open(const FString& InFilename)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	Filename = InFilename;
+
+	if (FImGuiOutputLogCapture::IsCaptureFile(Filename))
+	{
+		Capture = MakeUnique<FImGuiOutputLogCapture>();
+		const bool bLoaded = Capture->Load(Filename, Columns);
+		ParseTime = FPlatformTime::Seconds() - StartTime;
+		return bLoaded;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*Filename);
+	if (OpenResult.HasError())
+	{
+		return false;
+	}
+
+	MappedFile = OpenResult.StealValue();
+	if (MappedFile->GetFileSize() == 0)
+	{
+		return true;
+	}
+
+	MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	if (!MappedRegion)
+	{
+		return false;
+	}
+
+	const char* Data = reinterpret_cast<const char*>(MappedRegion->GetMappedPtr());
+	const int64 Size = MappedRegion->GetMappedSize();
+
+	// The ring a session kept its last messages in; they're stored as they were, so there's nothing to parse
+	if (FImGuiOutputLogSharedRingReader::IsRing(MappedRegion->GetMappedPtr(), Size))
+	{
+		TArray<TPair<char*, int32>> LocalCategories;
+		const bool bLoaded = FImGuiOutputLogSharedRingReader::ReadAll(MappedRegion->GetMappedPtr(), Size,
+			[this, &LocalCategories](const FImGuiOutputLogRingRecord& Record)
+			{
+				Columns.Add(Record.Text, Record.TextLen,
+					InternCategory(Record.Category, Record.CategoryLen, LocalCategories),
+					Record.Verbosity, Record.Ticks, Record.Frame);
+				Columns.PlayInEditorIds.Add(Record.PlayInEditorId);
+			});
+
+		ParseTime = FPlatformTime::Seconds() - StartTime;
+		return bLoaded;
+	}
+
+	// Every chunk is scanned on its own; messages continued over chunk borders are stitched back together afterward
+	const int32 ChunksNum = static_cast<int32>((Size + ChunkSize - 1) / ChunkSize);
+	TArray<FChunk> Chunks;
+	Chunks.SetNum(ChunksNum);
+
+	ParallelFor(ChunksNum, [this, Data, Size, &Chunks](int32 ChunkIndex)
+	{
+		LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+		// A chunk owns the lines that begin in it
+		const char* Begin = Data + ChunkIndex * ChunkSize;
+		const char* End = Data + FMath::Min(Size, (ChunkIndex + 1) * ChunkSize);
+		if (ChunkIndex > 0)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(Begin - 1, '\n', End - Begin + 1));
+			Begin = LineEnd ? LineEnd + 1 : End;
+		}
+
+		ParseChunk(Begin, End, Chunks[ChunkIndex]);
+	});
+
+	int32 MessagesNum = 0;
+	for (const FChunk& Chunk : Chunks)
+	{
+		MessagesNum += Chunk.Columns.Num();
+	}
+
+	Columns.Reserve(MessagesNum);
+	for (FChunk& Chunk : Chunks)
+	{
+		if (Chunk.LeadingLinesEnd && Columns.Num() > 0)
+		{
+			Columns.ExtendLast(Chunk.LeadingLinesEnd, Chunk.LeadingLinesNum);
+		}
+
+		Columns.Append(MoveTemp(Chunk.Columns));
+	}
+
+	// The engine only writes the last 3 digits of the frame number, so it's counted up whenever it wraps around
+	uint64 FrameBase = 0;
+	uint64 PreviousFrame = 0;
+	for (uint64& Frame : Columns.Frames)
+	{
+		if (Frame == MAX_uint64)
+		{
+			Frame = PreviousFrame + FrameBase;
+			continue;
+		}
+
+		if (Frame < PreviousFrame)
+		{
+			FrameBase += 1000;
+		}
+
+		PreviousFrame = Frame;
+		Frame += FrameBase;
+	}
+
+	ParseTime = FPlatformTime::Seconds() - StartTime;
+	return true;
+}
+
+const FString& FImGuiOutputLogFileSource::GetFilename() const
+{
+	return Filename;
+}
+
+int64 FImGuiOutputLogFileSource::GetFileSize() const
+{
+	return FPlatformFileManager::Get().GetPlatformFile().FileSize(*Filename);
+}
+
+double FImGuiOutputLogFileSource::GetParseTime() const
+{
+	return ParseTime;
+}
+
+int32 FImGuiOutputLogFileSource::GetMessagesNum() const
+{
+	return Columns.Num();
+}
+
+const FImGuiOutputLogMessageColumns& FImGuiOutputLogFileSource::GetColumns() const
+{
+	return Columns;
+}
+
+const TArray<char*>& FImGuiOutputLogFileSource::GetCategories() const
+{
+	return Capture ? Capture->GetCategories() : Categories;
+}
+
+ImGui::Private::TMessageRef FImGuiOutputLogFileSource::MakeMessage(int32 Index) const
+{
+	ImGui::Private::TMessageRef Message = MakeShared<ImGui::Private::TMessage>();
+	MakeMessage(Index, *Message);
+	return Message;
+}
+
+void FImGuiOutputLogFileSource::MakeMessage(int32 Index, ImGui::Private::TMessage& OutMessage) const
+{
+	Columns.MakeMessage(Index, GetCategories(), OutMessage);
+}
+
+void FImGuiOutputLogFileSource::ParseChunk(const char* Begin, const char* End, FChunk& OutChunk)
+{
+	FImGuiOutputLogMessageColumns& ChunkColumns = OutChunk.Columns;
+	TArray<TPair<char*, int32>> LocalCategories;
+	FLinePrefix Prefix;
+
+	const char* LineBegin = Begin;
+	while (LineBegin < End)
+	{
+		// The last line of a chunk may end in the next one
+		const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', End - LineBegin));
+		if (!LineEnd)
+		{
+			const char* FileEnd = reinterpret_cast<const char*>(MappedRegion->GetMappedPtr()) + MappedRegion->GetMappedSize();
+			LineEnd = static_cast<const char*>(memchr(End, '\n', FileEnd - End));
+			LineEnd = LineEnd ? LineEnd : FileEnd;
+		}
+
+		if (ParseLinePrefix(LineBegin, LineEnd, Prefix))
+		{
+			ChunkColumns.Add(Prefix.Text, LineEnd - Prefix.Text,
+				InternCategory(Prefix.Category, Prefix.CategoryLen, LocalCategories),
+				Prefix.Verbosity, Prefix.Timestamp.GetTicks(), Prefix.Frame);
+		}
+		else if (ChunkColumns.Num() > 0)
+		{
+			// Lines without the prefix belong to the message above, e.g. call stacks
+			ChunkColumns.ExtendLast(LineEnd, 1);
+		}
+		else
+		{
+			OutChunk.LeadingLinesEnd = LineEnd;
+			OutChunk.LeadingLinesNum++;
+		}
+
+		LineBegin = LineEnd + 1;
+	}
+}
+
+bool FImGuiOutputLogFileSource::ParseLinePrefix(const char* Begin, const char* End, FLinePrefix& OutPrefix)
+{
+	// [2025.06.01-12.34.56:789][  0]Category: Verbosity: Text
+	// Both the timestamp and the frame are optional, and so is the verbosity
+
+	// Unknown until proven otherwise; those are given the frame of the message above
+	OutPrefix.Frame = MAX_uint64;
+
+	const char* It = Begin;
+	if (It < End && *It == '[')
+	{
+		const char* TimestampEnd = static_cast<const char*>(memchr(It, ']', End - It));
+		if (!TimestampEnd || !ParseTimestamp(It + 1, TimestampEnd, OutPrefix.Timestamp))
+		{
+			return false;
+		}
+
+		It = TimestampEnd + 1;
+
+		if (It < End && *It == '[')
+		{
+			const char* FrameEnd = static_cast<const char*>(memchr(It, ']', End - It));
+			if (!FrameEnd)
+			{
+				return false;
+			}
+
+			OutPrefix.Frame = 0;
+			for (const char* Digit = It + 1; Digit < FrameEnd; ++Digit)
+			{
+				if (FCharAnsi::IsDigit(*Digit))
+				{
+					OutPrefix.Frame = OutPrefix.Frame * 10 + (*Digit - '0');
+				}
+			}
+
+			It = FrameEnd + 1;
+		}
+	}
+
+	const char* CategoryBegin = It;
+	while (It < End && (FCharAnsi::IsAlnum(*It) || *It == '_'))
+	{
+		++It;
+	}
+
+	if (It == CategoryBegin || End - It < 2 || It[0] != ':' || It[1] != ' ')
+	{
+		return false;
+	}
+
+	OutPrefix.Category = CategoryBegin;
+	OutPrefix.CategoryLen = It - CategoryBegin;
+	It += 2;
+
+	const char* VerbosityBegin = It;
+	while (It < End && FCharAnsi::IsAlpha(*It))
+	{
+		++It;
+	}
+
+	if (End - It >= 2 && It[0] == ':' && It[1] == ' ' && ParseVerbosity(VerbosityBegin, It, OutPrefix.Verbosity))
+	{
+		It += 2;
+	}
+	else
+	{
+		It = VerbosityBegin;
+		OutPrefix.Verbosity = EImGuiLogVerbosity::Log;
+	}
+
+	OutPrefix.Text = It;
+
+	return true;
+}
+
+static bool IsSameCategory(const char* Category, const char* Begin, int32 Len)
+{
+	return FCStringAnsi::Strncmp(Category, Begin, Len) == 0 && Category[Len] == '\0';
+}
+
+int32 FImGuiOutputLogFileSource::InternCategory(const char* Begin, int32 Len,
+	TArray<TPair<char*, int32>>& LocalCategories)
+{
+	// Each chunk remembers what it has seen, so the lock is only taken for categories new to the chunk
+	for (const auto& [Category, Index] : LocalCategories)
+	{
+		if (IsSameCategory(Category, Begin, Len))
+		{
+			return Index;
+		}
+	}
+
+	FScopeLock Lock(&CategoriesCriticalSection);
+
+	int32 Index = Categories.IndexOfByPredicate([Begin, Len](const char* Category)
+	{
+		return IsSameCategory(Category, Begin, Len);
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		char* Category = static_cast<char*>(malloc(Len + 1));
+		FMemory::Memcpy(Category, Begin, Len);
+		Category[Len] = '\0';
+		Index = Categories.Add(Category);
+	}
+
+	LocalCategories.Add({ Categories[Index], Index });
+	return Index;
+}
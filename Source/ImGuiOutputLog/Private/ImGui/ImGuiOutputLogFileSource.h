@@ -0,0 +1,58 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessageColumns.h"
+
+class FImGuiOutputLogCapture;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Log file written by the engine, e.g. Saved/Logs/*.log, a capture, or the crash ring of a session, opened for viewing.
+ *
+ * Log files and rings are memory-mapped, and the messages point straight into the mapping instead of holding copies of the text,
+ * so they're only valid for as long as this object is alive. The same goes for the decompressed blocks of captures.
+ *
+ * The messages are kept in columns, as a file may have more of them than would fit in memory as objects.
+ */
+class FImGuiOutputLogFileSource
+{
+public:
+	~FImGuiOutputLogFileSource();
+
+	/** Maps and parses the whole file. Blocking; meant to be called off the game thread. */
+	bool Open(const FString& InFilename);
+
+	const FString& GetFilename() const;
+	int64 GetFileSize() const;
+	double GetParseTime() const;
+
+	int32 GetMessagesNum() const;
+	const FImGuiOutputLogMessageColumns& GetColumns() const;
+	const TArray<char*>& GetCategories() const;
+
+	/** Makes an object of the message at the index; it points into the source, so it can't outlive it. */
+	ImGui::Private::TMessageRef MakeMessage(int32 Index) const;
+	void MakeMessage(int32 Index, ImGui::Private::TMessage& OutMessage) const;
+
+private:
+	struct FChunk;
+	struct FLinePrefix;
+
+	void ParseChunk(const char* Begin, const char* End, FChunk& OutChunk);
+	static bool ParseLinePrefix(const char* Begin, const char* End, FLinePrefix& OutPrefix);
+	int32 InternCategory(const char* Begin, int32 Len, TArray<TPair<char*, int32>>& LocalCategories);
+
+private:
+	FImGuiOutputLogMessageColumns Columns;
+	FString Filename;
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TUniquePtr<FImGuiOutputLogCapture> Capture;
+	double ParseTime = 0.0;
+
+	// Messages point at these, so they're only freed along with the source
+	FCriticalSection CategoriesCriticalSection;
+	TArray<char*> Categories;
+};
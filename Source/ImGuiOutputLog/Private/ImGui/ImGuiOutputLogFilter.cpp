@@ -2,14 +2,228 @@
 
 #include "ImGui/ImGuiOutputLogFilter.h"
 
+#include "Algo/StableSort.h"
 #include "imgui_internal.h"
+#include "ImGui/ImGuiEngineOutputLog.h"
+#include "ImGui/ImGuiOutputLogThreads.h"
+#include "ImGui/ImGuiOutputLogTrigramIndex.h"
+
+static bool StartsWith(const char* Begin, const char* End, const char* Prefix)
+{
+	const int32 PrefixLen = FCStringAnsi::Strlen(Prefix);
+	return End - Begin >= PrefixLen && FCStringAnsi::Strnicmp(Begin, Prefix, PrefixLen) == 0;
+}
+
+static bool MatchWildcard(const char* Pattern, const char* PatternEnd, const char* Text, const char* TextEnd)
+{
+	// Whenever a * fails to match, it's retried with one more character swallowed
+	const char* StarPattern = nullptr;
+	const char* StarText = nullptr;
+	while (Text < TextEnd)
+	{
+		if (Pattern < PatternEnd && *Pattern == '*')
+		{
+			StarPattern = ++Pattern;
+			StarText = Text;
+		}
+		else if (Pattern < PatternEnd && (*Pattern == '?' || FCharAnsi::ToLower(*Pattern) == FCharAnsi::ToLower(*Text)))
+		{
+			++Pattern;
+			++Text;
+		}
+		else if (StarPattern)
+		{
+			Pattern = StarPattern;
+			Text = ++StarText;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while (Pattern < PatternEnd && *Pattern == '*')
+	{
+		++Pattern;
+	}
+
+	return Pattern == PatternEnd;
+}
+
+static bool ParseVerbosityName(const char* Begin, const char* End, EImGuiLogVerbosity& OutVerbosity)
+{
+	for (const auto Verbosity : TEnumRange<EImGuiLogVerbosity>())
+	{
+		// "Very Verbose" can't be typed with the space, as that would split it in two
+		const char* Name = ImGui::Private::TMessage::VerbosityToString(Verbosity);
+		const char* It = Begin;
+		for (; *Name != '\0' && It < End; ++Name)
+		{
+			if (*Name != ' ')
+			{
+				if (FCharAnsi::ToLower(*Name) != FCharAnsi::ToLower(*It))
+				{
+					break;
+				}
+
+				++It;
+			}
+		}
+
+		if (*Name == '\0' && It == End)
+		{
+			OutVerbosity = Verbosity;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool ParseDuration(const char* Begin, const char* End, FTimespan& OutDuration)
+{
+	// The sign is optional; it's always about the past anyway
+	if (Begin < End && (*Begin == '-' || *Begin == '+'))
+	{
+		++Begin;
+	}
+
+	const char* It = Begin;
+	while (It < End && (FCharAnsi::IsDigit(*It) || *It == '.'))
+	{
+		++It;
+	}
+
+	if (It == Begin)
+	{
+		return false;
+	}
+
+	static const TPair<const char*, double> Units[] =
+	{
+		{ "", 1.0 },
+		{ "ms", 0.001 },
+		{ "s", 1.0 },
+		{ "m", 60.0 },
+		{ "h", 60.0 * 60.0 },
+		{ "d", 24.0 * 60.0 * 60.0 },
+	};
+
+	const int32 UnitLen = End - It;
+	for (const auto& [Unit, Seconds] : Units)
+	{
+		if (FCStringAnsi::Strlen(Unit) == UnitLen && FCStringAnsi::Strnicmp(Unit, It, UnitLen) == 0)
+		{
+			OutDuration = FTimespan::FromSeconds(FCStringAnsi::Atod(Begin) * Seconds);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool ParseNumber(const char*& It, const char* End, uint64& OutValue)
+{
+	const char* Begin = It;
+	OutValue = 0;
+	while (It < End && FCharAnsi::IsDigit(*It))
+	{
+		OutValue = OutValue * 10 + (*It++ - '0');
+	}
+
+	return It != Begin;
+}
+
+static void Intersect(TArray<int32>& InOut, const TArray<int32>& Other)
+{
+	int32 Out = 0;
+	for (int32 i = 0, j = 0; i < InOut.Num() && j < Other.Num();)
+	{
+		if (InOut[i] < Other[j])
+		{
+			i++;
+		}
+		else if (InOut[i] > Other[j])
+		{
+			j++;
+		}
+		else
+		{
+			InOut[Out++] = InOut[i];
+			i++;
+			j++;
+		}
+	}
+
+	InOut.SetNum(Out, EAllowShrinking::No);
+}
+
+static void Union(TArray<int32>& InOut, const TArray<int32>& Other, TArray<int32>& Scratch)
+{
+	Scratch.Reset(InOut.Num() + Other.Num());
+	int32 i = 0;
+	int32 j = 0;
+	while (i < InOut.Num() || j < Other.Num())
+	{
+		if (j == Other.Num() || (i < InOut.Num() && InOut[i] < Other[j]))
+		{
+			Scratch.Add(InOut[i++]);
+		}
+		else if (i == InOut.Num() || Other[j] < InOut[i])
+		{
+			Scratch.Add(Other[j++]);
+		}
+		else
+		{
+			Scratch.Add(InOut[i++]);
+			j++;
+		}
+	}
+
+	Swap(InOut, Scratch);
+}
 
 FImGuiOutputLogFilter::FContext::~FContext()
+{
+	ResetCategories();
+}
+
+void FImGuiOutputLogFilter::FContext::ResetCategories()
 {
 	for (const auto& [Category, _]  : Categories)
 	{
 		free(Category);
 	}
+
+	Categories.Empty();
+	DeactivatedCategories = 0;
+	KnownCategoryIndices.Empty();
+}
+
+void FImGuiOutputLogFilter::FContext::AddCategoryOf(const ImGui::Private::TMessage& Message)
+{
+	if (Message.CategoryIndex != INDEX_NONE)
+	{
+		if (Message.CategoryIndex >= KnownCategoryIndices.Num())
+		{
+			KnownCategoryIndices.Add(false, Message.CategoryIndex + 1 - KnownCategoryIndices.Num());
+		}
+		else if (KnownCategoryIndices[Message.CategoryIndex])
+		{
+			return;
+		}
+
+		KnownCategoryIndices[Message.CategoryIndex] = true;
+	}
+	else if (Categories.ContainsByPredicate([&Message](const TPair<char*, bool>& Category)
+		{
+			return ImStricmp(Category.Key, Message.Category) == 0;
+		}))
+	{
+		return;
+	}
+
+	Categories.Add({ ImStrdup(Message.Category), true });
 }
 
 FImGuiOutputLogFilter::FImGuiOutputLogFilter()
@@ -28,17 +242,33 @@ bool FImGuiOutputLogFilter::Draw()
 
 bool FImGuiOutputLogFilter::PassFilter(const ImGui::Private::TMessageRef Message) const
 {
+	// From the cheapest checks to the most expensive one
 	if (!PassFilter_Verbosity(Message))
 	{
 		return false;
 	}
 
-	if (!PassFilter_Text(Message))
+	if (!PassFilter_Category(Message))
 	{
 		return false;
 	}
 
-	if (!PassFilter_Category(Message))
+	if (!PassFilter_Client(Message))
+	{
+		return false;
+	}
+
+	if (!PassFilter_Thread(Message))
+	{
+		return false;
+	}
+
+	if (!PassFilter_Range(Message))
+	{
+		return false;
+	}
+
+	if (!PassFilter_Query(Message))
 	{
 		return false;
 	}
@@ -52,15 +282,125 @@ void FImGuiOutputLogFilter::Clear()
 	Build();
 }
 
+void FImGuiOutputLogFilter::SetQuery(const char* Query)
+{
+	ImStrncpy(InputBuf, Query, IM_ARRAYSIZE(InputBuf));
+	Build();
+}
+
+const char* FImGuiOutputLogFilter::GetQuery() const
+{
+	return InputBuf;
+}
+
+FImGuiOutputLogFilter::FRange FImGuiOutputLogFilter::GetRange() const
+{
+	FRange Range = Context.Range;
+
+	// With alternatives, a message may be out of the range of one of them and still pass another
+	if (Groups.Num() == 1)
+	{
+		for (const FTerm& Term : Groups[0])
+		{
+			if (!Term.bNegated && (Term.Type == ETermType::Time || Term.Type == ETermType::Frame))
+			{
+				Range.Intersect({ Term.MinTicks, Term.MaxTicks, Term.MinFrame, Term.MaxFrame });
+			}
+		}
+	}
+
+	return Range;
+}
+
 bool FImGuiOutputLogFilter::IsActive() const
 {
-	return !Filters.empty()
+	return !Groups.IsEmpty()
+		|| !CommonTerms.IsEmpty()
+		|| Context.Range.IsSet()
+		|| (Context.bOwnClientOnly && Context.PlayInEditorId != INDEX_NONE)
+		|| Context.HiddenThreadsNum > 0
 		|| !Context.bShowErrors
 		|| !Context.bShowMessages
 		|| !Context.bShowWarnings
 		|| Context.DeactivatedCategories > 0;
 }
 
+bool FImGuiOutputLogFilter::FindCandidates(const FImGuiOutputLogTrigramIndex& Index, TArray<int32>& OutCandidates,
+	int32& OutIndexedNum) const
+{
+	// Exclusions alone can't narrow anything down
+	if (Groups.IsEmpty())
+	{
+		return false;
+	}
+
+	OutCandidates.Reset();
+	OutIndexedNum = MAX_int32;
+
+	TArray<int32> GroupCandidates;
+	TArray<int32> Found;
+	TArray<int32> Scratch;
+	for (const TArray<FTerm>& Group : Groups)
+	{
+		bool bIsNarrowed = false;
+		for (const FTerm& Term : Group)
+		{
+			if (Term.Type != ETermType::Text || Term.bNegated || CouldMatchUnindexedElements(Term.Begin, Term.End))
+			{
+				continue;
+			}
+
+			int32 IndexedNum;
+			if (!Index.FindCandidates(Term.Begin, Term.End, Found, IndexedNum))
+			{
+				continue;
+			}
+
+			// The index may have grown in between, so only the part all searches have seen can be trusted
+			OutIndexedNum = FMath::Min(OutIndexedNum, IndexedNum);
+
+			// All texts of a group have to be there
+			if (bIsNarrowed)
+			{
+				Intersect(GroupCandidates, Found);
+			}
+			else
+			{
+				Swap(GroupCandidates, Found);
+				bIsNarrowed = true;
+			}
+		}
+
+		// Any message may pass a group the index can't tell anything about
+		if (!bIsNarrowed)
+		{
+			return false;
+		}
+
+		Union(OutCandidates, GroupCandidates, Scratch);
+	}
+
+	return true;
+}
+
+void FImGuiOutputLogFilter::ResetCategoryVerdicts()
+{
+	CategoryVerdicts.Reset();
+
+	for (const TArray<FTerm>& Group : Groups)
+	{
+		for (const FTerm& Term : Group)
+		{
+			Term.CategoryVerdicts.Reset();
+		}
+	}
+
+	for (const FTerm& Term : CommonTerms)
+	{
+		Term.CategoryVerdicts.Reset();
+	}
+}
+
 bool FImGuiOutputLogFilter::DrawInputText()
 {
 	if (Context.Width != 0.0f)
@@ -69,6 +409,13 @@ bool FImGuiOutputLogFilter::DrawInputText()
 	}
 
 	const bool bValueChanged = ImGui::InputTextWithHint(Context.Label, Context.Hint, InputBuf, IM_ARRAYSIZE(InputBuf));
+	ImGui::SetItemTooltip(
+		"Words separated by spaces must all be found, groups separated by commas are alternatives.\n"
+		"\"exact phrase\"    -excluded\n"
+		"cat:LogNet*       lvl>=Warning (also <=, >, <, =)\n"
+		"since:-30s        until:2025.06.01-12.34.56\n"
+		"frame:1200..1300");
+
 	if (bValueChanged)
 	{
 		Build();
@@ -135,16 +482,47 @@ bool FImGuiOutputLogFilter::DrawCategoryFilters()
 			CategoryFilter.Clear();
 		}
 
+		// Only the live log knows which threads its messages come from
+		FImGuiOutputLogThreads& Threads = FImGuiOutputLogThreads::Get();
+		const int32 ThreadsNum = Threads.Num();
+		if (ThreadsNum > 0 && ImGui::BeginMenu("Threads"))
+		{
+			Context.HiddenThreads.SetNum(ThreadsNum, false);
+			for (int32 i = 0; i < ThreadsNum; ++i)
+			{
+				bool bIsEnabled = !Context.HiddenThreads[i];
+				if (ImGui::MenuItem(Threads.GetName(i), "", &bIsEnabled))
+				{
+					Context.HiddenThreads[i] = !bIsEnabled;
+					Context.HiddenThreadsNum += bIsEnabled ? -1 : +1;
+					bHasChanged = true;
+				}
+			}
+
+			ImGui::EndMenu();
+		}
+
 		ImGui::SeparatorText("Verbosity");
 
 		bHasChanged |= ImGui::MenuItem("Messages", "", &Context.bShowMessages);
 		bHasChanged |= ImGui::MenuItem("Warnings", "", &Context.bShowWarnings);
 		bHasChanged |= ImGui::MenuItem("Errors", "", &Context.bShowErrors);
 
+		if (Context.PlayInEditorId != INDEX_NONE)
+		{
+			ImGui::SeparatorText("Clients");
+			bHasChanged |= ImGui::MenuItem("This Client Only", "", &Context.bOwnClientOnly);
+		}
+
 		ImGui::PopItemFlag();
 		ImGui::EndPopup();
 	}
 
+	if (bHasChanged)
+	{
+		CategoryVerdicts.Reset();
+	}
+
 	return bHasChanged;
 }
 
@@ -170,127 +548,478 @@ bool FImGuiOutputLogFilter::PassFilter_Category(const ImGui::Private::TMessageRe
 		return false;
 	}
 
-	for (const auto& [Category, bIsEnabled] : Context.Categories)
+	// The categories the verdicts were made against have changed
+	if (CategoriesNumWhenDecided != Context.Categories.Num())
 	{
-		if (!bIsEnabled)
+		CategoryVerdicts.Reset();
+		CategoriesNumWhenDecided = Context.Categories.Num();
+	}
+
+	return CategoryVerdicts.Get(Message->CategoryIndex, [this, &Message]
+	{
+		for (const auto& [Category, bIsEnabled] : Context.Categories)
 		{
-			continue;
+			if (!bIsEnabled)
+			{
+				continue;
+			}
+
+			if (ImStristr(Message->Category, Message->Category + Message->CategoryLen, Category, nullptr))
+			{
+				return true;
+			}
 		}
 
-		if (ImStristr(Message->Category, Message->Category + Message->CategoryLen, Category, nullptr))
+		return false;
+	});
+}
+
+bool FImGuiOutputLogFilter::PassFilter_Client(const ImGui::Private::TMessageRef Message) const
+{
+	if (!Context.bOwnClientOnly || Context.PlayInEditorId == INDEX_NONE)
+	{
+		return true;
+	}
+
+	// Whatever wasn't logged on behalf of a particular instance, e.g. by the editor, concerns every client
+	return Message->PlayInEditorId == INDEX_NONE || Message->PlayInEditorId == Context.PlayInEditorId;
+}
+
+bool FImGuiOutputLogFilter::PassFilter_Thread(const ImGui::Private::TMessageRef Message) const
+{
+	const int32 ThreadIndex = Message->ThreadIndex;
+	if (Context.HiddenThreadsNum == 0 || ThreadIndex == INDEX_NONE || ThreadIndex >= Context.HiddenThreads.Num())
+	{
+		return true;
+	}
+
+	return !Context.HiddenThreads[ThreadIndex];
+}
+
+bool FImGuiOutputLogFilter::PassFilter_Range(const ImGui::Private::TMessageRef Message) const
+{
+	const FRange& Range = Context.Range;
+	const int64 Ticks = Message->Timestamp.GetTicks();
+	return Ticks >= Range.MinTicks && Ticks <= Range.MaxTicks
+		&& Message->Frame >= Range.MinFrame && Message->Frame <= Range.MaxFrame;
+}
+
+bool FImGuiOutputLogFilter::PassFilter_Query(const ImGui::Private::TMessageRef Message) const
+{
+	// Old messages may have to be decompressed, so the text is only read once, and only if a term needs it
+	FImGuiOutputLogText Text;
+
+	bool bPassedGroup = Groups.IsEmpty();
+	for (const TArray<FTerm>& Group : Groups)
+	{
+		bPassedGroup = true;
+		for (const FTerm& Term : Group)
 		{
-			return true;
+			if (!PassTerm(Term, Message, Text))
+			{
+				bPassedGroup = false;
+				break;
+			}
+		}
+
+		if (bPassedGroup)
+		{
+			break;
 		}
 	}
 
-	return false;
+	if (!bPassedGroup)
+	{
+		return false;
+	}
+
+	for (const FTerm& Term : CommonTerms)
+	{
+		if (!PassTerm(Term, Message, Text))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FImGuiOutputLogFilter::PassTerm(const FTerm& Term, const ImGui::Private::TMessageRef Message,
+	FImGuiOutputLogText& Text) const
+{
+	bool bPassed = false;
+	switch (Term.Type)
+	{
+	case ETermType::Verbosity:
+		bPassed = Message->Verbosity >= Term.MinVerbosity && Message->Verbosity <= Term.MaxVerbosity;
+		break;
+	case ETermType::Category:
+		bPassed = Term.CategoryVerdicts.Get(Message->CategoryIndex, [&Term, &Message]
+		{
+			return MatchWildcard(Term.Begin, Term.End, Message->Category, Message->Category + Message->CategoryLen);
+		});
+		break;
+	case ETermType::Time:
+	{
+		const int64 Ticks = Message->Timestamp.GetTicks();
+		bPassed = Ticks >= Term.MinTicks && Ticks <= Term.MaxTicks;
+		break;
+	}
+	case ETermType::Frame:
+		bPassed = Message->Frame >= Term.MinFrame && Message->Frame <= Term.MaxFrame;
+		break;
+	case ETermType::Text:
+		if (!Text.Begin)
+		{
+			Text = Message->GetText();
+		}
+
+		bPassed = ContainsText(Message, Text, Term.Begin, Term.End);
+		break;
+	}
+
+	return bPassed != Term.bNegated;
 }
 
-bool FImGuiOutputLogFilter::PassFilter_Text(const ImGui::Private::TMessageRef Message) const
+bool FImGuiOutputLogFilter::ContainsText(const ImGui::Private::TMessageRef Message, const FImGuiOutputLogText& Text,
+	const char* Begin, const char* End) const
 {
-	if (Filters.Size == 0)
+	if (ImStristr(Text.Begin, Text.End, Begin, End))
 	{
 		return true;
 	}
 
-	for (const FTextRange& Filter : Filters)
+	// The elements aren't stored next to the text, so they're searched separately
+	if (Context.Elements & EImGuiOutputLogMessageElement::Category)
 	{
-		if (Filter.Begin == Filter.End)
+		if (ImStristr(Message->Category, Message->Category + Message->CategoryLen, Begin, End))
 		{
-			continue;
+			return true;
+		}
+	}
+
+	if (Context.Elements & EImGuiOutputLogMessageElement::Verbosity)
+	{
+		if (ImStristr(ImGui::Private::TMessage::VerbosityToString(Message->Verbosity), nullptr, Begin, End))
+		{
+			return true;
+		}
+	}
+
+	if ((Context.Elements & EImGuiOutputLogMessageElement::Thread) && Message->ThreadIndex != INDEX_NONE)
+	{
+		if (ImStristr(FImGuiOutputLogThreads::Get().GetName(Message->ThreadIndex), nullptr, Begin, End))
+		{
+			return true;
+		}
+	}
+
+	if (Context.Elements & EImGuiOutputLogMessageElement::Timestamp)
+	{
+		char Timestamp[32];
+		const int32 TimestampLen = Message->FormatTimestamp(Timestamp, sizeof(Timestamp));
+		if (ImStristr(Timestamp, Timestamp + TimestampLen, Begin, End))
+		{
+			return true;
 		}
+	}
+
+	return false;
+}
 
-		if (Filter.Begin[0] == '-')
+bool FImGuiOutputLogFilter::CouldMatchUnindexedElements(const char* Begin, const char* End) const
+{
+	// Only the texts and the categories are indexed
+	if (Context.Elements & EImGuiOutputLogMessageElement::Verbosity)
+	{
+		for (const auto Verbosity : TEnumRange<EImGuiLogVerbosity>())
 		{
-			// Subtract
-			if (ImStristr(Message->FormattedText, Message->FormattedText + Message->FormattedTextLen,
-				Filter.Begin + 1, Filter.End))
+			if (ImStristr(ImGui::Private::TMessage::VerbosityToString(Verbosity), nullptr, Begin, End))
 			{
-				return false;
+				return true;
 			}
 		}
-		else
+	}
+
+	if (Context.Elements & EImGuiOutputLogMessageElement::Thread)
+	{
+		FImGuiOutputLogThreads& Threads = FImGuiOutputLogThreads::Get();
+		for (int32 i = 0; i < Threads.Num(); ++i)
 		{
-			// Grep
-			if (ImStristr(Message->FormattedText, Message->FormattedText + Message->FormattedTextLen,
-				Filter.Begin, Filter.End))
+			if (ImStristr(Threads.GetName(i), nullptr, Begin, End))
 			{
 				return true;
 			}
 		}
 	}
 
-	// Implicit * grep
-	if (CountGrep == 0)
+	if (Context.Elements & EImGuiOutputLogMessageElement::Timestamp)
 	{
-		return true;
+		bool bCouldBeTimestamp = true;
+		for (const char* It = Begin; It < End && bCouldBeTimestamp; ++It)
+		{
+			bCouldBeTimestamp = FCharAnsi::IsDigit(*It) || *It == '.' || *It == '-' || *It == ':';
+		}
+
+		if (bCouldBeTimestamp)
+		{
+			return true;
+		}
 	}
 
 	return false;
 }
 
-FImGuiOutputLogFilter::FTextRange::FTextRange(const char* InBegin, const char* InEnd)
-	: Begin(InBegin)
-	, End(InEnd)
+bool FImGuiOutputLogFilter::FRange::IsSet() const
+{
+	return MinTicks != MIN_int64 || MaxTicks != MAX_int64 || MinFrame != 0 || MaxFrame != MAX_uint64;
+}
+
+void FImGuiOutputLogFilter::FRange::Intersect(const FRange& Other)
+{
+	MinTicks = FMath::Max(MinTicks, Other.MinTicks);
+	MaxTicks = FMath::Min(MaxTicks, Other.MaxTicks);
+	MinFrame = FMath::Max(MinFrame, Other.MinFrame);
+	MaxFrame = FMath::Min(MaxFrame, Other.MaxFrame);
+}
+
+template<typename FunctionType>
+bool FImGuiOutputLogFilter::FCategoryVerdicts::Get(int32 CategoryIndex, FunctionType&& Decide)
 {
+	if (CategoryIndex == INDEX_NONE)
+	{
+		return Decide();
+	}
+
+	if (CategoryIndex >= Decided.Num())
+	{
+		const int32 AddedNum = CategoryIndex + 1 - Decided.Num();
+		Decided.Add(false, AddedNum);
+		Passed.Add(false, AddedNum);
+	}
+
+	if (!Decided[CategoryIndex])
+	{
+		Decided[CategoryIndex] = true;
+		Passed[CategoryIndex] = Decide();
+	}
+
+	return Passed[CategoryIndex];
 }
 
-bool FImGuiOutputLogFilter::FTextRange::IsEmpty() const
+void FImGuiOutputLogFilter::FCategoryVerdicts::Reset()
 {
-	return Begin == End;
+	Decided.Reset();
+	Passed.Reset();
 }
 
 void FImGuiOutputLogFilter::Build()
 {
-	Filters.resize(0);
-	Split(InputBuf, ',', &Filters);
+	Groups.Reset();
+	CommonTerms.Reset();
+	ResetCategoryVerdicts();
+
+	TArray<FTerm> Terms;
+	auto FinishGroup = [this, &Terms]
+	{
+		// Stable, so that the texts are still searched in the order they were typed
+		Algo::StableSortBy(Terms, &FTerm::Type);
+
+		// A group of nothing but exclusions applies to all messages, like it used to before there were groups
+		const bool bHasInclusions = Terms.ContainsByPredicate([](const FTerm& Term)
+		{
+			return !Term.bNegated;
+		});
+
+		if (bHasInclusions)
+		{
+			Groups.Add(MoveTemp(Terms));
+		}
+		else
+		{
+			CommonTerms.Append(MoveTemp(Terms));
+			Algo::StableSortBy(CommonTerms, &FTerm::Type);
+		}
+
+		Terms.Reset();
+	};
 
-	CountGrep = 0;
-	for (FTextRange& Filter : Filters)
+	const char* It = InputBuf;
+	while (true)
 	{
-		while (Filter.Begin < Filter.End && ImCharIsBlankA(Filter.Begin[0]))
+		while (ImCharIsBlankA(*It))
 		{
-			Filter.Begin++;
+			++It;
 		}
 
-		while (Filter.End > Filter.Begin && ImCharIsBlankA(Filter.End[-1]))
+		if (*It == '\0' || *It == ',')
+		{
+			FinishGroup();
+
+			if (*It == '\0')
+			{
+				break;
+			}
+
+			++It;
+			continue;
+		}
+
+		FTerm Term;
+		if (*It == '-')
+		{
+			Term.bNegated = true;
+			++It;
+		}
+
+		const char* Begin = It;
+		const char* End;
+		const bool bIsQuoted = *It == '"';
+		if (bIsQuoted)
+		{
+			Begin = ++It;
+			while (*It != '\0' && *It != '"')
+			{
+				++It;
+			}
+
+			End = It;
+			if (*It == '"')
+			{
+				++It;
+			}
+		}
+		else
 		{
-			Filter.End--;
+			while (*It != '\0' && *It != ',' && !ImCharIsBlankA(*It))
+			{
+				++It;
+			}
+
+			End = It;
 		}
 
-		if (Filter.IsEmpty())
+		if (Begin == End)
 		{
 			continue;
 		}
 
-		if (Filter.Begin[0] != '-')
+		// Anything that doesn't parse as a keyword is searched for as is
+		if (bIsQuoted || !ParseTerm(Begin, End, Term))
 		{
-			CountGrep++;
+			Term.Type = ETermType::Text;
+			Term.Begin = Begin;
+			Term.End = End;
 		}
+
+		Terms.Add(MoveTemp(Term));
 	}
 }
 
-void FImGuiOutputLogFilter::Split(const char* Buffer, char Separator, ImVector<FTextRange>* Out)
+bool FImGuiOutputLogFilter::ParseTerm(const char* Begin, const char* End, FTerm& OutTerm)
 {
-	Out->resize(0);
+	if (StartsWith(Begin, End, "cat:") && End - Begin > 4)
+	{
+		OutTerm.Type = ETermType::Category;
+		OutTerm.Begin = Begin + 4;
+		OutTerm.End = End;
+		return true;
+	}
+
+	if (StartsWith(Begin, End, "lvl"))
+	{
+		const char* It = Begin + 3;
+		const char* Operators[] = { ">=", "<=", ">", "<", "=", ":" };
+		for (const char* Operator : Operators)
+		{
+			if (!StartsWith(It, End, Operator))
+			{
+				continue;
+			}
+
+			EImGuiLogVerbosity Verbosity;
+			if (!ParseVerbosityName(It + FCStringAnsi::Strlen(Operator), End, Verbosity))
+			{
+				return false;
+			}
+
+			// The more severe, the lower the verbosity
+			const uint8 Value = static_cast<uint8>(Verbosity);
+			OutTerm.Type = ETermType::Verbosity;
+			switch (Operator[0])
+			{
+			case '>':
+				OutTerm.MaxVerbosity = static_cast<EImGuiLogVerbosity>(Operator[1] == '=' ? Value : Value - 1);
+				break;
+			case '<':
+				OutTerm.MinVerbosity = static_cast<EImGuiLogVerbosity>(Operator[1] == '=' ? Value : Value + 1);
+				break;
+			default:
+				OutTerm.MinVerbosity = Verbosity;
+				OutTerm.MaxVerbosity = Verbosity;
+				break;
+			}
+
+			return true;
+		}
 
-	const char* BufferEnd = Buffer + ImStrlen(Buffer);
-	const char* CurrentBegin = Buffer;
-	const char* CurrentEnd = CurrentBegin;
+		return false;
+	}
 
-	while (CurrentEnd < BufferEnd)
+	const bool bIsSince = StartsWith(Begin, End, "since:");
+	if (bIsSince || StartsWith(Begin, End, "until:"))
 	{
-		if (*CurrentEnd == Separator)
+		const char* ValueBegin = Begin + 6;
+
+		// Either relative to now, e.g. -30s, or a timestamp the way the log displays it
+		FDateTime Time;
+		FTimespan Duration;
+		if (ParseDuration(ValueBegin, End, Duration))
+		{
+			Time = FDateTime::Now() - Duration;
+		}
+		else if (!FDateTime::Parse(FString(End - ValueBegin, ValueBegin), Time))
 		{
-			Out->push_back(FTextRange(CurrentBegin, CurrentEnd));
-			CurrentBegin = CurrentEnd + 1;
+			return false;
 		}
 
-		CurrentEnd++;
+		OutTerm.Type = ETermType::Time;
+		(bIsSince ? OutTerm.MinTicks : OutTerm.MaxTicks) = Time.GetTicks();
+		return true;
 	}
 
-	if (CurrentBegin != CurrentEnd)
+	if (StartsWith(Begin, End, "frame:"))
 	{
-		Out->push_back(FTextRange(CurrentBegin, CurrentEnd));
+		// frame:N, frame:N..M, frame:N.. or frame:..M
+		const char* It = Begin + 6;
+		uint64 First;
+		const bool bHasFirst = ParseNumber(It, End, First);
+		if (It == End && bHasFirst)
+		{
+			OutTerm.Type = ETermType::Frame;
+			OutTerm.MinFrame = First;
+			OutTerm.MaxFrame = First;
+			return true;
+		}
+
+		if (!StartsWith(It, End, ".."))
+		{
+			return false;
+		}
+
+		It += 2;
+		uint64 Last;
+		const bool bHasLast = ParseNumber(It, End, Last);
+		if (It != End || (!bHasFirst && !bHasLast))
+		{
+			return false;
+		}
+
+		OutTerm.Type = ETermType::Frame;
+		OutTerm.MinFrame = bHasFirst ? First : 0;
+		OutTerm.MaxFrame = bHasLast ? Last : MAX_uint64;
+		return true;
 	}
+
+	return false;
 }
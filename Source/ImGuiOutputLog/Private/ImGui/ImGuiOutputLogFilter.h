@@ -6,14 +6,35 @@
 #include "ImGui/ImGuiTextFilter.h"
 #include "ImGui/ImGuiOutputLogMessage.h"
 
+class FImGuiOutputLogTrigramIndex;
+
 struct FImGuiOutputLogFilter
 {
 public:
+	/** Span of time and frames to keep messages from, both inclusive. */
+	struct FRange
+	{
+	public:
+		bool IsSet() const;
+		void Intersect(const FRange& Other);
+
+	public:
+		int64 MinTicks = MIN_int64;
+		int64 MaxTicks = MAX_int64;
+		uint64 MinFrame = 0;
+		uint64 MaxFrame = MAX_uint64;
+	};
+
 	struct FContext
 	{
 	public:
 		~FContext();
 
+		void ResetCategories();
+
+		/** Adds the category of the message, enabled, unless it's there already; for filters without a category list. */
+		void AddCategoryOf(const ImGui::Private::TMessage& Message);
+
 	public:
 		const char* Label = "";
 		const char* Hint = "";
@@ -26,6 +47,23 @@ public:
 		bool bShowMessages = true;
 		bool bShowWarnings = true;
 		bool bShowErrors = true;
+
+		// PIE instance of the log, INDEX_NONE outside of PIE; messages of the other instances can be hidden
+		int32 PlayInEditorId = INDEX_NONE;
+		bool bOwnClientOnly = false;
+
+		// Threads whose messages are hidden, by their index in FImGuiOutputLogThreads
+		TBitArray<> HiddenThreads;
+		int32 HiddenThreadsNum = 0;
+
+		// Elements displayed next to the text; the text search goes through them as well
+		uint8 Elements = 0;
+
+		FRange Range;
+
+	private:
+		// Indices of the categories added through AddCategoryOf
+		TBitArray<> KnownCategoryIndices;
 	};
 
 public:
@@ -36,36 +74,97 @@ public:
 	void Clear();
 	bool IsActive() const;
 
+	/** Replaces the search, as if it was typed in. */
+	void SetQuery(const char* Query);
+	const char* GetQuery() const;
+
+	/** The range set in the context, narrowed down by the ranges in the search that all messages have to be in. */
+	FRange GetRange() const;
+
+	/**
+	 * Narrows the text search down to the messages among the first OutIndexedNum that the index can't rule out.
+	 * Fails if the index can't tell anything about the current search.
+	 */
+	bool FindCandidates(const FImGuiOutputLogTrigramIndex& Index, TArray<int32>& OutCandidates,
+		int32& OutIndexedNum) const;
+
+	/** Forgets what has been decided per category, e.g. because the messages now come from another source. */
+	void ResetCategoryVerdicts();
+
 private:
 	bool DrawInputText();
 	bool DrawCategoryFilters();
 
 	bool PassFilter_Verbosity(const ImGui::Private::TMessageRef Message) const;
 	bool PassFilter_Category(const ImGui::Private::TMessageRef Message) const;
-	bool PassFilter_Text(const ImGui::Private::TMessageRef Message) const;
+	bool PassFilter_Client(const ImGui::Private::TMessageRef Message) const;
+	bool PassFilter_Thread(const ImGui::Private::TMessageRef Message) const;
+	bool PassFilter_Range(const ImGui::Private::TMessageRef Message) const;
+	bool PassFilter_Query(const ImGui::Private::TMessageRef Message) const;
+	bool ContainsText(const ImGui::Private::TMessageRef Message, const FImGuiOutputLogText& Text, const char* Begin,
+		const char* End) const;
+	bool CouldMatchUnindexedElements(const char* Begin, const char* End) const;
 
 private:
-	struct FTextRange
+	/** What has been decided for each category index, so that categories are only matched once. */
+	struct FCategoryVerdicts
 	{
 	public:
-		FTextRange(const char* InBegin, const char* InEnd);
-		bool IsEmpty() const;
+		template<typename FunctionType>
+		bool Get(int32 CategoryIndex, FunctionType&& Decide);
+		void Reset();
 
 	public:
-		const char* Begin;
-		const char* End;
+		TBitArray<> Decided;
+		TBitArray<> Passed;
+	};
+
+	// Ordered from the cheapest to check to the most expensive, which is the order they're checked in
+	enum class ETermType : uint8
+	{
+		Verbosity,
+		Category,
+		Time,
+		Frame,
+		Text,
+	};
+
+	struct FTerm
+	{
+	public:
+		ETermType Type = ETermType::Text;
+		bool bNegated = false;
+
+		// Text to search for, or the category pattern
+		const char* Begin = nullptr;
+		const char* End = nullptr;
+
+		EImGuiLogVerbosity MinVerbosity = EImGuiLogVerbosity::Fatal;
+		EImGuiLogVerbosity MaxVerbosity = EImGuiLogVerbosity::VeryVerbose;
+		int64 MinTicks = MIN_int64;
+		int64 MaxTicks = MAX_int64;
+		uint64 MinFrame = 0;
+		uint64 MaxFrame = MAX_uint64;
+
+		mutable FCategoryVerdicts CategoryVerdicts;
 	};
 
 	void Build();
-	static void Split(const char* Buffer, char Separator, ImVector<FTextRange>* Out);
+	bool PassTerm(const FTerm& Term, const ImGui::Private::TMessageRef Message, FImGuiOutputLogText& Text) const;
+	static bool ParseTerm(const char* Begin, const char* End, FTerm& OutTerm);
 
 public:
 	FContext Context;
 
 private:
 	char InputBuf[256];
-	ImVector<FTextRange> Filters;
-	int CountGrep = 0;
 
-    FImGuiTextFilter CategoryFilter;
+	// A message has to pass all terms of any of the groups, and all the common terms, e.g. the exclusions
+	TArray<TArray<FTerm>> Groups;
+	TArray<FTerm> CommonTerms;
+
+	FImGuiTextFilter CategoryFilter;
+
+	mutable FCategoryVerdicts CategoryVerdicts;
+	mutable int32 CategoriesNumWhenDecided = 0;
 };
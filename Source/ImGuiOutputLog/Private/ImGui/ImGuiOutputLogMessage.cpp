@@ -2,9 +2,80 @@
 
 #include "ImGuiOutputLogMessage.h"
 
+#include "ImGui/ImGuiOutputLogColdStore.h"
+
 FImGuiOutputLogMessage::~FImGuiOutputLogMessage()
 {
-	free(Text);
-	free(Category);
-	free(FormattedText);
+	if (bOwnsStrings)
+	{
+		free(Text);
+		free(Category);
+	}
+}
+
+FImGuiOutputLogText FImGuiOutputLogMessage::GetText() const
+{
+	if (!ColdBlock)
+	{
+		// Other threads are registered as readers, and pinning on them would only make them contend for the count
+		return { Text, Text + TextLen, IsInGameThread() ? FImGuiOutputLogColdStore::Get().PinHotTexts() : nullptr };
+	}
+
+	FImGuiOutputLogText Result = FImGuiOutputLogColdStore::Get().Thaw(ColdBlock);
+	Result.Begin = Result.Pin->GetData() + ColdOffset;
+	Result.End = Result.Begin + TextLen;
+	return Result;
+}
+
+int32 FImGuiOutputLogMessage::GetLinesNum() const
+{
+	return LineBreaks.Num() + 1;
+}
+
+void FImGuiOutputLogMessage::GetLine(const FImGuiOutputLogText& InText, int32 Index, const char*& OutBegin,
+	const char*& OutEnd) const
+{
+	check(Index >= 0 && Index < GetLinesNum());
+
+	OutBegin = InText.Begin + (Index > 0 ? LineBreaks[Index - 1] + 1 : 0);
+	OutEnd = InText.Begin + (Index < LineBreaks.Num() ? LineBreaks[Index] : TextLen);
+
+	// Files written on Windows end their lines with \r\n
+	if (OutEnd > OutBegin && OutEnd[-1] == '\r')
+	{
+		OutEnd--;
+	}
+}
+
+void FImGuiOutputLogMessage::FindLineBreaks()
+{
+	LineBreaks.Reset();
+
+	const char* End = Text + TextLen;
+	for (const char* It = Text; (It = static_cast<const char*>(memchr(It, '\n', End - It))) != nullptr; ++It)
+	{
+		LineBreaks.Add(It - Text);
+	}
+}
+
+int32 FImGuiOutputLogMessage::FormatTimestamp(char* Out, int32 OutSize) const
+{
+	return FCStringAnsi::Snprintf(Out, OutSize, "%04d.%02d.%02d-%02d.%02d.%02d:%03d",
+		Timestamp.GetYear(), Timestamp.GetMonth(), Timestamp.GetDay(),
+		Timestamp.GetHour(), Timestamp.GetMinute(), Timestamp.GetSecond(), Timestamp.GetMillisecond());
+}
+
+const char* FImGuiOutputLogMessage::VerbosityToString(EImGuiLogVerbosity Verbosity)
+{
+	switch (Verbosity)
+	{
+	case EImGuiLogVerbosity::Verbose: return "Verbose";
+	case EImGuiLogVerbosity::VeryVerbose: return "Very Verbose";
+	case EImGuiLogVerbosity::Log: return "Log";
+	case EImGuiLogVerbosity::Display: return "Display";
+	case EImGuiLogVerbosity::Warning: return "Warning";
+	case EImGuiLogVerbosity::Error: return "Error";
+	case EImGuiLogVerbosity::Fatal: return "Fatal";
+	default: return "Invalid";
+	}
 }
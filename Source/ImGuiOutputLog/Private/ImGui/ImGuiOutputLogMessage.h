@@ -4,26 +4,70 @@
 
 #include "ImGui/ImGuiLogVerbosity.h"
 
+struct FImGuiOutputLogColdBlock;
+
+/**
+ * Text of a message, which stays valid for as long as this is alive, even if it had to be decompressed, or the message
+ * is moved to the cold tier in the meantime. The latter only holds on the game thread; other threads have to be
+ * registered as readers of the cold store.
+ */
+struct FImGuiOutputLogText
+{
+public:
+	const char* Begin = nullptr;
+	const char* End = nullptr;
+	TSharedPtr<const TArray<char>, ESPMode::ThreadSafe> Pin;
+};
+
 struct FImGuiOutputLogMessage
 {
 public:
 	~FImGuiOutputLogMessage();
 
+	FImGuiOutputLogText GetText() const;
+
+	int32 GetLinesNum() const;
+	void GetLine(const FImGuiOutputLogText& InText, int32 Index, const char*& OutBegin, const char*& OutEnd) const;
+	void FindLineBreaks();
+
+	int32 FormatTimestamp(char* Out, int32 OutSize) const;
+	static const char* VerbosityToString(EImGuiLogVerbosity Verbosity);
+
 public:
 	char* Text = nullptr;
 	int32 TextLen = 0;
-	TArray<int32> LineOffsets;
+
+	// Offsets of the '\n's in the text; single-line messages don't allocate anything
+	TArray<int32> LineBreaks;
 
 	char* Category = nullptr;
 	int32 CategoryLen = 0;
 
-	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+	// Position of the category among the ones of the same source, so that filters can decide once per category
+	int32 CategoryIndex = INDEX_NONE;
 
-	char* FormattedText = nullptr;
-	int32 FormattedTextLen = 0;
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
 
 	FDateTime Timestamp;
-	bool bIsFilteredOut = false;
+
+	// Position of the message in its source, which never changes; for the live log it counts from the engine start
+	uint64 Sequence = 0;
+
+	// Engine frame the message was logged on, 0 if unknown
+	uint64 Frame = 0;
+
+	// PIE instance that was being ticked when the message was logged; INDEX_NONE outside of PIE or if unknown
+	int32 PlayInEditorId = INDEX_NONE;
+
+	// Thread the message was logged from, see FImGuiOutputLogThreads; INDEX_NONE if unknown, e.g. read from a file
+	int32 ThreadIndex = INDEX_NONE;
+
+	// Whether the text and category are ours to free, or belong to someone else, e.g. a mapped log file
+	bool bOwnsStrings = true;
+
+	// Set once the text has been moved to the cold tier, after which Text is null; use GetText to read it
+	TSharedPtr<FImGuiOutputLogColdBlock, ESPMode::ThreadSafe> ColdBlock;
+	int32 ColdOffset = 0;
 };
 
 namespace ImGui::Private
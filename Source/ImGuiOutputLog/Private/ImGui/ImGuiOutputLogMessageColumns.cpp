@@ -0,0 +1,101 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogMessageColumns.h"
+
+void FImGuiOutputLogMessageColumns::Add(const char* Text, int32 TextLen, int32 CategoryIndex,
+	EImGuiLogVerbosity Verbosity, int64 InTicks, uint64 Frame)
+{
+	Texts.Add(Text);
+	TextLens.Add(TextLen);
+	FirstLines.Add(LinesNum);
+	CategoryIndices.Add(CategoryIndex);
+	Verbosities.Add(Verbosity);
+	Ticks.Add(InTicks);
+	Frames.Add(Frame);
+
+	LinesNum++;
+
+	const char* End = Text + TextLen;
+	for (const char* It = Text; (It = static_cast<const char*>(memchr(It, '\n', End - It))) != nullptr; ++It)
+	{
+		LinesNum++;
+	}
+}
+
+void FImGuiOutputLogMessageColumns::ExtendLast(const char* TextEnd, int32 ExtraLinesNum)
+{
+	TextLens.Last() = TextEnd - Texts.Last();
+	LinesNum += ExtraLinesNum;
+}
+
+void FImGuiOutputLogMessageColumns::Append(FImGuiOutputLogMessageColumns&& Other)
+{
+	// The lines of the other columns count from 0
+	const int32 FirstLinesNum = FirstLines.Num();
+	FirstLines.Append(MoveTemp(Other.FirstLines));
+	for (int32 i = FirstLinesNum; i < FirstLines.Num(); ++i)
+	{
+		FirstLines[i] += LinesNum;
+	}
+
+	Texts.Append(MoveTemp(Other.Texts));
+	TextLens.Append(MoveTemp(Other.TextLens));
+	CategoryIndices.Append(MoveTemp(Other.CategoryIndices));
+	Verbosities.Append(MoveTemp(Other.Verbosities));
+	Ticks.Append(MoveTemp(Other.Ticks));
+	Frames.Append(MoveTemp(Other.Frames));
+	PlayInEditorIds.Append(MoveTemp(Other.PlayInEditorIds));
+	LinesNum += Other.LinesNum;
+
+	Other.LinesNum = 0;
+}
+
+void FImGuiOutputLogMessageColumns::Reserve(int32 InNum)
+{
+	Texts.Reserve(InNum);
+	TextLens.Reserve(InNum);
+	FirstLines.Reserve(InNum);
+	CategoryIndices.Reserve(InNum);
+	Verbosities.Reserve(InNum);
+	Ticks.Reserve(InNum);
+	Frames.Reserve(InNum);
+}
+
+int32 FImGuiOutputLogMessageColumns::Num() const
+{
+	return Texts.Num();
+}
+
+int32 FImGuiOutputLogMessageColumns::GetLinesNum() const
+{
+	return LinesNum;
+}
+
+int32 FImGuiOutputLogMessageColumns::GetFirstLine(int32 Index) const
+{
+	return Index < FirstLines.Num() ? FirstLines[Index] : LinesNum;
+}
+
+void FImGuiOutputLogMessageColumns::MakeMessage(int32 Index, const TArray<char*>& Categories,
+	ImGui::Private::TMessage& OutMessage) const
+{
+	OutMessage.bOwnsStrings = false;
+	OutMessage.Text = const_cast<char*>(Texts[Index]);
+	OutMessage.TextLen = TextLens[Index];
+	OutMessage.FindLineBreaks();
+	OutMessage.CategoryIndex = CategoryIndices[Index];
+	OutMessage.Category = Categories[OutMessage.CategoryIndex];
+	OutMessage.CategoryLen = FCStringAnsi::Strlen(OutMessage.Category);
+	OutMessage.Verbosity = Verbosities[Index];
+	OutMessage.Timestamp = FDateTime(Ticks[Index]);
+	OutMessage.Sequence = Index;
+	OutMessage.Frame = Frames[Index];
+	OutMessage.PlayInEditorId = PlayInEditorIds.IsValidIndex(Index) ? PlayInEditorIds[Index] : INDEX_NONE;
+}
+
+SIZE_T FImGuiOutputLogMessageColumns::GetAllocatedSize() const
+{
+	return Texts.GetAllocatedSize() + TextLens.GetAllocatedSize() + FirstLines.GetAllocatedSize()
+		+ CategoryIndices.GetAllocatedSize() + Verbosities.GetAllocatedSize() + Ticks.GetAllocatedSize()
+		+ Frames.GetAllocatedSize() + PlayInEditorIds.GetAllocatedSize();
+}
@@ -0,0 +1,50 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+/**
+ * Messages of a file kept a column per field rather than as message objects, which would take several times the size
+ * of a short line each. The texts point into memory owned by whoever filled the columns, e.g. a mapped log file, and
+ * message objects are only made for the ones that are shown or exported.
+ */
+struct FImGuiOutputLogMessageColumns
+{
+public:
+	/** Adds a message of as many lines as its text has. */
+	void Add(const char* Text, int32 TextLen, int32 CategoryIndex, EImGuiLogVerbosity Verbosity, int64 Ticks,
+		uint64 Frame);
+
+	/** Makes the last message end at the given character, past the lines that were found to continue it. */
+	void ExtendLast(const char* TextEnd, int32 ExtraLinesNum);
+
+	void Append(FImGuiOutputLogMessageColumns&& Other);
+	void Reserve(int32 InNum);
+
+	int32 Num() const;
+	int32 GetLinesNum() const;
+
+	/** Index of the first line of the message; the number of lines for the one past the last. */
+	int32 GetFirstLine(int32 Index) const;
+
+	/** Makes the message at the index into an object, which points at the same text and categories. */
+	void MakeMessage(int32 Index, const TArray<char*>& Categories, ImGui::Private::TMessage& OutMessage) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+public:
+	TArray<const char*> Texts;
+	TArray<int32> TextLens;
+	TArray<int32> FirstLines;
+	TArray<int32> CategoryIndices;
+	TArray<EImGuiLogVerbosity> Verbosities;
+	TArray<int64> Ticks;
+	TArray<uint64> Frames;
+
+	// Only rings know it, so it stays empty for the rest
+	TArray<int32> PlayInEditorIds;
+
+private:
+	int32 LinesNum = 0;
+};
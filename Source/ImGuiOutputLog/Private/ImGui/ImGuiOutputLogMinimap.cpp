@@ -0,0 +1,103 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogMinimap.h"
+
+FImGuiOutputLogMinimap::FImGuiOutputLogMinimap()
+{
+	Buckets.SetNum(BucketsNum);
+}
+
+void FImGuiOutputLogMinimap::Add(EImGuiLogVerbosity Verbosity, int32 InLinesNum)
+{
+	const bool bIsError = Verbosity <= EImGuiLogVerbosity::Error;
+	const bool bIsWarning = Verbosity == EImGuiLogVerbosity::Warning;
+
+	for (int32 i = 0; i < InLinesNum; ++i)
+	{
+		if (LinesNum / LinesPerBucket >= BucketsNum)
+		{
+			Merge();
+		}
+
+		FBucket& Bucket = Buckets[LinesNum / LinesPerBucket];
+		Bucket.Errors += bIsError;
+		Bucket.Warnings += bIsWarning;
+		LinesNum++;
+	}
+}
+
+void FImGuiOutputLogMinimap::Reset()
+{
+	for (FBucket& Bucket : Buckets)
+	{
+		Bucket = FBucket();
+	}
+
+	LinesPerBucket = 1;
+	LinesNum = 0;
+}
+
+int32 FImGuiOutputLogMinimap::Draw(const ImVec2& Size, int32 FirstVisibleLine, int32 VisibleLinesNum) const
+{
+	const ImVec2 Min = ImGui::GetCursorScreenPos();
+	const ImVec2 Max(Min.x + Size.x, Min.y + Size.y);
+	const bool bIsClicked = ImGui::InvisibleButton("Minimap", Size);
+
+	ImDrawList* DrawList = ImGui::GetWindowDrawList();
+	DrawList->AddRectFilled(Min, Max, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+	if (LinesNum == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Everything goes into the same draw command, no matter how many buckets are in use
+	const float LineHeight = Size.y / LinesNum;
+	const int32 UsedBucketsNum = FMath::DivideAndRoundUp(LinesNum, LinesPerBucket);
+	for (int32 i = 0; i < UsedBucketsNum; ++i)
+	{
+		const FBucket& Bucket = Buckets[i];
+		if (Bucket.Errors == 0 && Bucket.Warnings == 0)
+		{
+			continue;
+		}
+
+		// Errors win over warnings; the more of them, the more opaque, but even a single one has to be seen
+		const bool bHasErrors = Bucket.Errors > 0;
+		const int32 Count = bHasErrors ? Bucket.Errors : Bucket.Warnings;
+		const float Alpha = 0.4f + 0.6f * FMath::Min(1.f, 4.f * Count / LinesPerBucket);
+		const ImU32 Color = bHasErrors ? IM_COL32(234, 11, 0, 255 * Alpha) : IM_COL32(243, 175, 0, 255 * Alpha);
+
+		const float Top = Min.y + i * LinesPerBucket * LineHeight;
+		const float Bottom = FMath::Max(Top + 1.f, Min.y + FMath::Min((i + 1) * LinesPerBucket, LinesNum) * LineHeight);
+		DrawList->AddRectFilled(ImVec2(Min.x, Top), ImVec2(Max.x, Bottom), Color);
+	}
+
+	const float VisibleTop = Min.y + FirstVisibleLine * LineHeight;
+	const float VisibleBottom = FMath::Min(Max.y, VisibleTop + FMath::Max(VisibleLinesNum * LineHeight, 2.f));
+	DrawList->AddRect(ImVec2(Min.x, VisibleTop), ImVec2(Max.x, VisibleBottom), ImGui::GetColorU32(ImGuiCol_Text, 0.6f));
+
+	if (!bIsClicked)
+	{
+		return INDEX_NONE;
+	}
+
+	const float ClickedY = ImGui::GetIO().MouseClickedPos[ImGuiMouseButton_Left].y - Min.y;
+	return FMath::Clamp(static_cast<int32>(ClickedY / Size.y * LinesNum), 0, LinesNum - 1);
+}
+
+void FImGuiOutputLogMinimap::Merge()
+{
+	for (int32 i = 0; i < BucketsNum / 2; ++i)
+	{
+		Buckets[i].Warnings = Buckets[2 * i].Warnings + Buckets[2 * i + 1].Warnings;
+		Buckets[i].Errors = Buckets[2 * i].Errors + Buckets[2 * i + 1].Errors;
+	}
+
+	for (int32 i = BucketsNum / 2; i < BucketsNum; ++i)
+	{
+		Buckets[i] = FBucket();
+	}
+
+	LinesPerBucket *= 2;
+}
@@ -0,0 +1,43 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "imgui.h"
+#include "ImGui/ImGuiLogVerbosity.h"
+
+/**
+ * Strip next to the log showing where the warnings and errors are.
+ *
+ * Lines are counted into a fixed number of buckets as they're displayed. Once all buckets are in use, neighbors are
+ * merged and each bucket covers twice as many lines, so the cost of adding a line never depends on the log size, and
+ * neither does drawing.
+ */
+class FImGuiOutputLogMinimap
+{
+public:
+	FImGuiOutputLogMinimap();
+
+	void Add(EImGuiLogVerbosity Verbosity, int32 LinesNum);
+	void Reset();
+
+	/** Returns the line that was clicked, or INDEX_NONE. */
+	int32 Draw(const ImVec2& Size, int32 FirstVisibleLine, int32 VisibleLinesNum) const;
+
+public:
+	static constexpr int32 BucketsNum = 256;
+
+private:
+	struct FBucket
+	{
+	public:
+		int32 Warnings = 0;
+		int32 Errors = 0;
+	};
+
+	void Merge();
+
+private:
+	TArray<FBucket> Buckets;
+	int32 LinesPerBucket = 1;
+	int32 LinesNum = 0;
+};
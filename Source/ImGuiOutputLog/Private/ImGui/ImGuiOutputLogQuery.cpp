@@ -0,0 +1,159 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogQuery.h"
+
+#include "Engine/Engine.h"
+#include "ImGui/ImGuiOutputLogBuffer.h"
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGui/ImGuiOutputLogFilter.h"
+#include "ImGuiOutputLogStats.h"
+
+FImGuiOutputLogSnapshot::~FImGuiOutputLogSnapshot()
+{
+	FImGuiOutputLogColdStore::Get().RemoveReader();
+}
+
+TSharedPtr<FImGuiOutputLogSnapshot> FImGuiOutputLogSnapshot::Take(const FImGuiOutputLogQueryParams& Params)
+{
+	LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+	const UImGuiOutputLogBuffer* LogBuffer = GEngine ? GEngine->GetEngineSubsystem<UImGuiOutputLogBuffer>() : nullptr;
+	if (!LogBuffer)
+	{
+		return nullptr;
+	}
+
+	FImGuiOutputLogFilter Filter;
+	Filter.SetQuery(TCHAR_TO_ANSI(*Params.Query));
+	Filter.Context.Range.MinTicks = Params.MinTime.GetTicks();
+	Filter.Context.Range.MaxTicks = Params.MaxTime.GetTicks();
+	Filter.Context.Range.MinFrame = Params.MinFrame;
+	Filter.Context.Range.MaxFrame = Params.MaxFrame;
+	Filter.Context.PlayInEditorId = Params.PlayInEditorId;
+	Filter.Context.bOwnClientOnly = Params.PlayInEditorId != INDEX_NONE;
+
+	TSharedPtr<FImGuiOutputLogSnapshot> Snapshot = MakeShareable(new FImGuiOutputLogSnapshot());
+	int32 BeginIndex = 0;
+	TArray<ImGui::Private::TMessageRef> Candidates;
+	{
+		FReadScopeLock Lock(LogBuffer->MessagesLock);
+
+		// Registered while holding the lock, so that the texts can't be moved to the cold tier from now on
+		FImGuiOutputLogColdStore::Get().AddReader();
+
+		const TArray<ImGui::Private::TMessageRef>& Messages = LogBuffer->Messages;
+		Snapshot->EndIndex = Messages.Num();
+		BeginIndex = FMath::Clamp(Params.BeginIndex, 0, Messages.Num());
+		const int32 EndIndex = FMath::Clamp(Params.EndIndex, BeginIndex, Messages.Num());
+		Candidates.Append(Messages.GetData() + BeginIndex, EndIndex - BeginIndex);
+	}
+
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		ImGui::Private::TMessageRef& Message = Candidates[i];
+
+		// The filter only lets the categories it knows about through
+		Filter.Context.AddCategoryOf(*Message);
+		if (!Filter.PassFilter(Message))
+		{
+			continue;
+		}
+
+		const FImGuiOutputLogText Text = Message->GetText();
+		if (Text.Pin && (Snapshot->Pins.IsEmpty() || Snapshot->Pins.Last() != Text.Pin))
+		{
+			Snapshot->Pins.Add(Text.Pin);
+		}
+
+		Snapshot->Texts.Emplace(Text.Begin, static_cast<int32>(Text.End - Text.Begin));
+		Snapshot->Indices.Add(BeginIndex + i);
+		Snapshot->Messages.Add(MoveTemp(Message));
+	}
+
+	return Snapshot;
+}
+
+int32 FImGuiOutputLogSnapshot::Num() const
+{
+	return Messages.Num();
+}
+
+FImGuiOutputLogMessageView FImGuiOutputLogSnapshot::operator[](int32 Index) const
+{
+	const ImGui::Private::TMessage& Message = *Messages[Index];
+
+	FImGuiOutputLogMessageView View;
+	View.Index = Indices[Index];
+	View.Text = Texts[Index];
+	View.Category = FAnsiStringView(Message.Category, Message.CategoryLen);
+	View.Verbosity = Message.Verbosity;
+	View.Timestamp = Message.Timestamp;
+	View.Frame = Message.Frame;
+	View.PlayInEditorId = Message.PlayInEditorId;
+	return View;
+}
+
+int32 FImGuiOutputLogSnapshot::GetEndIndex() const
+{
+	return EndIndex;
+}
+
+TArray<FImGuiOutputLogEntry> UImGuiOutputLogQueryLibrary::QueryMessagesByIndex(const FString& Query, int32 First,
+	int32 Last)
+{
+	FImGuiOutputLogQueryParams Params;
+	Params.Query = Query;
+	Params.BeginIndex = First;
+	Params.EndIndex = Last < 0 ? MAX_int32 : Last + 1;
+	return RunQuery(Params);
+}
+
+TArray<FImGuiOutputLogEntry> UImGuiOutputLogQueryLibrary::QueryMessagesByTime(const FString& Query, FDateTime From,
+	FDateTime To)
+{
+	FImGuiOutputLogQueryParams Params;
+	Params.Query = Query;
+	Params.MinTime = From;
+	Params.MaxTime = To;
+	return RunQuery(Params);
+}
+
+int32 UImGuiOutputLogQueryLibrary::GetMessagesNum()
+{
+	const UImGuiOutputLogBuffer* LogBuffer = GEngine ? GEngine->GetEngineSubsystem<UImGuiOutputLogBuffer>() : nullptr;
+	if (!LogBuffer)
+	{
+		return 0;
+	}
+
+	FReadScopeLock Lock(LogBuffer->MessagesLock);
+	return LogBuffer->Messages.Num();
+}
+
+TArray<FImGuiOutputLogEntry> UImGuiOutputLogQueryLibrary::RunQuery(const FImGuiOutputLogQueryParams& Params)
+{
+	TArray<FImGuiOutputLogEntry> Entries;
+
+	const TSharedPtr<FImGuiOutputLogSnapshot> Snapshot = FImGuiOutputLogSnapshot::Take(Params);
+	if (!Snapshot)
+	{
+		return Entries;
+	}
+
+	// Blueprints can't hold on to views, so this is where the texts get copied
+	Entries.Reserve(Snapshot->Num());
+	for (int32 i = 0; i < Snapshot->Num(); ++i)
+	{
+		const FImGuiOutputLogMessageView View = (*Snapshot)[i];
+
+		FImGuiOutputLogEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Index = View.Index;
+		Entry.Text = FString(View.Text.Len(), View.Text.GetData());
+		Entry.Category = FString(View.Category.Len(), View.Category.GetData());
+		Entry.Verbosity = View.Verbosity;
+		Entry.Timestamp = View.Timestamp;
+		Entry.Frame = static_cast<int64>(View.Frame);
+	}
+
+	return Entries;
+}
@@ -0,0 +1,521 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogSharedRing.h"
+
+#include "ImGuiOutputLog.h"
+#include "ImGui/ImGuiOutputLogDeadline.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+
+static_assert(std::atomic<uint64>::is_always_lock_free, "The ring is shared between processes, so it can't lock");
+
+struct FImGuiOutputLogSharedRingHeader
+{
+public:
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint64 Capacity = 0;
+
+	// Each on its own cache line, so that the readers polling the head don't get in the way of the writer
+	alignas(64) std::atomic<uint64> Head = 0;
+	alignas(64) std::atomic<uint64> Tail = 0;
+	alignas(64) std::atomic<uint64> MessagesNum = 0;
+};
+
+namespace
+{
+	struct FRecord
+	{
+	public:
+		uint32 Size = 0;
+		uint16 CategoryLen = 0;
+		uint8 Verbosity = 0;
+		uint8 Flags = 0;
+		uint64 Sequence = 0;
+		int64 Ticks = 0;
+		uint64 Frame = 0;
+		int32 PlayInEditorId = INDEX_NONE;
+		uint32 TextLen = 0;
+	};
+
+	static_assert(sizeof(FRecord) == 40, "The record layout is part of the documented format");
+
+	enum ERecordFlags : uint8
+	{
+		Padding = 1 << 0,
+	};
+}
+
+static constexpr uint32 RingMagic = 0x52474c49; // "ILGR"
+static constexpr uint32 RingVersion = 1;
+static constexpr uint64 RecordAlignment = 8;
+static constexpr uint64 MinCapacity = 64 * 1024;
+
+// Record sizes are 32-bit, and a padding record can take almost the whole ring
+static constexpr uint64 MaxCapacity = 1ull << 31;
+static constexpr int32 MinPageSize = 1024 * 1024;
+static constexpr uint64 MaxCategoryLen = 1024;
+
+static uint32 GetAccessMode(bool bWrite)
+{
+	return bWrite
+		? FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write
+		: FPlatformMemory::ESharedMemoryAccess::Read;
+}
+
+// The engine can only map files for reading, so writable mappings are made here
+static void* MapFileForWriting(const FString& Filename, uint64 Size)
+{
+#if PLATFORM_WINDOWS
+	HANDLE File = CreateFileW(*Filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		return nullptr;
+	}
+
+	HANDLE Mapping = CreateFileMappingW(File, nullptr, PAGE_READWRITE, static_cast<DWORD>(Size >> 32),
+		static_cast<DWORD>(Size & MAX_uint32), nullptr);
+	void* Memory = Mapping ? MapViewOfFile(Mapping, FILE_MAP_ALL_ACCESS, 0, 0, Size) : nullptr;
+
+	// The view keeps both alive
+	if (Mapping)
+	{
+		CloseHandle(Mapping);
+	}
+
+	CloseHandle(File);
+	return Memory;
+#else
+	const int File = open(TCHAR_TO_UTF8(*Filename), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (File < 0)
+	{
+		return nullptr;
+	}
+
+	void* Memory = ftruncate(File, Size) == 0
+		? mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, File, 0)
+		: MAP_FAILED;
+
+	// The mapping keeps the file alive
+	close(File);
+	return Memory != MAP_FAILED ? Memory : nullptr;
+#endif
+}
+
+static void UnmapFile(void* Memory, uint64 Size)
+{
+#if PLATFORM_WINDOWS
+	UnmapViewOfFile(Memory);
+#else
+	munmap(Memory, Size);
+#endif
+}
+
+FImGuiOutputLogSharedRingWriter::~FImGuiOutputLogSharedRingWriter()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+
+	if (MappedFile)
+	{
+		UnmapFile(MappedFile, MappedFileSize);
+	}
+}
+
+bool FImGuiOutputLogSharedRingWriter::Create(const FString& Name, uint64 InCapacity)
+{
+	if (InCapacity > MaxCapacity)
+	{
+		return false;
+	}
+
+	Capacity = FMath::RoundUpToPowerOfTwo64(FMath::Max(InCapacity, MinCapacity));
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, true, GetAccessMode(true),
+		sizeof(FImGuiOutputLogSharedRingHeader) + Capacity);
+
+	if (!Region)
+	{
+		return false;
+	}
+
+	Initialize(Region->GetAddress());
+	return true;
+}
+
+bool FImGuiOutputLogSharedRingWriter::CreateInFile(const FString& Filename, uint64 InCapacity)
+{
+	if (InCapacity > MaxCapacity)
+	{
+		return false;
+	}
+
+	Capacity = FMath::RoundUpToPowerOfTwo64(FMath::Max(InCapacity, MinCapacity));
+	MappedFileSize = sizeof(FImGuiOutputLogSharedRingHeader) + Capacity;
+	MappedFile = MapFileForWriting(Filename, MappedFileSize);
+
+	if (!MappedFile)
+	{
+		return false;
+	}
+
+	Initialize(MappedFile);
+	return true;
+}
+
+void FImGuiOutputLogSharedRingWriter::Initialize(void* Memory)
+{
+	Header = new (Memory) FImGuiOutputLogSharedRingHeader();
+	Header->Version = RingVersion;
+	Header->Capacity = Capacity;
+	Data = static_cast<uint8*>(Memory) + sizeof(FImGuiOutputLogSharedRingHeader);
+
+	// Readers check the magic before anything else, so it goes last
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->Magic = RingMagic;
+}
+
+void FImGuiOutputLogSharedRingWriter::Write(const ImGui::Private::TMessage& Message)
+{
+	// A single message may not push everything else out of the ring
+	const uint64 CategoryLen = FMath::Min<uint64>(Message.CategoryLen, MaxCategoryLen);
+	const uint64 TextLen = FMath::Min<uint64>(Message.TextLen, Capacity / 4 - sizeof(FRecord) - CategoryLen);
+	const uint64 Size = Align(sizeof(FRecord) + CategoryLen + TextLen, RecordAlignment);
+
+	uint64 Offset = Head & (Capacity - 1);
+	if (Offset + Size > Capacity)
+	{
+		const uint64 PaddingSize = Capacity - Offset;
+		Reserve(PaddingSize);
+
+		FRecord Padding;
+		Padding.Size = PaddingSize;
+		Padding.Flags = ERecordFlags::Padding;
+		FMemory::Memcpy(Data + Offset, &Padding, FMath::Min<uint64>(sizeof(FRecord), PaddingSize));
+
+		Head += PaddingSize;
+		Offset = 0;
+	}
+
+	Reserve(Size);
+
+	FRecord Record;
+	Record.Size = Size;
+	Record.CategoryLen = CategoryLen;
+	Record.Verbosity = static_cast<uint8>(Message.Verbosity);
+	Record.Sequence = MessagesNum;
+	Record.Ticks = Message.Timestamp.GetTicks();
+	Record.Frame = Message.Frame;
+	Record.PlayInEditorId = Message.PlayInEditorId;
+	Record.TextLen = TextLen;
+
+	uint8* It = Data + Offset;
+	FMemory::Memcpy(It, &Record, sizeof(FRecord));
+	FMemory::Memcpy(It + sizeof(FRecord), Message.Category, CategoryLen);
+	FMemory::Memcpy(It + sizeof(FRecord) + CategoryLen, Message.Text, TextLen);
+
+	Head += Size;
+	MessagesNum++;
+
+	Header->MessagesNum.store(MessagesNum, std::memory_order_relaxed);
+	Header->Head.store(Head, std::memory_order_release);
+}
+
+void FImGuiOutputLogSharedRingWriter::Reserve(uint64 Size)
+{
+	if (Head + Size - Tail <= Capacity)
+	{
+		return;
+	}
+
+	while (Head + Size - Tail > Capacity)
+	{
+		uint32 RecordSize;
+		FMemory::Memcpy(&RecordSize, Data + (Tail & (Capacity - 1)), sizeof(RecordSize));
+		Tail += RecordSize;
+	}
+
+	// Whoever sees any of what's written after the fence sees the records it overwrites as given up
+	Header->Tail.store(Tail, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+FImGuiOutputLogSharedRingReader::~FImGuiOutputLogSharedRingReader()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+}
+
+bool FImGuiOutputLogSharedRingReader::Attach(const FString& InName)
+{
+	Name = InName;
+
+	// The size of the ring is only known from its header, so that's mapped first
+	FPlatformMemory::FSharedMemoryRegion* HeaderRegion = FPlatformMemory::MapNamedSharedMemoryRegion(Name, false,
+		GetAccessMode(false), sizeof(FImGuiOutputLogSharedRingHeader));
+
+	if (!HeaderRegion)
+	{
+		return false;
+	}
+
+	const auto* PeekedHeader = static_cast<const FImGuiOutputLogSharedRingHeader*>(HeaderRegion->GetAddress());
+	const bool bIsValid = PeekedHeader->Magic == RingMagic && PeekedHeader->Version == RingVersion
+		&& FMath::IsPowerOfTwo(PeekedHeader->Capacity) && PeekedHeader->Capacity >= MinCapacity
+		&& PeekedHeader->Capacity <= MaxCapacity;
+	const uint64 RingCapacity = PeekedHeader->Capacity;
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(HeaderRegion);
+
+	if (!bIsValid)
+	{
+		UE_LOG(LogImGuiOutputLog, Warning, TEXT("%s isn't a shared log, or one of another version"), *Name);
+		return false;
+	}
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, false, GetAccessMode(false),
+		sizeof(FImGuiOutputLogSharedRingHeader) + RingCapacity);
+
+	if (!Region)
+	{
+		return false;
+	}
+
+	Header = static_cast<const FImGuiOutputLogSharedRingHeader*>(Region->GetAddress());
+	Data = static_cast<const uint8*>(Region->GetAddress()) + sizeof(FImGuiOutputLogSharedRingHeader);
+	Capacity = RingCapacity;
+	ReadPosition = Header->Tail.load(std::memory_order_acquire);
+
+	return true;
+}
+
+void FImGuiOutputLogSharedRingReader::Poll(double Deadline)
+{
+	if (!Header)
+	{
+		return;
+	}
+
+	const uint64 Head = Header->Head.load(std::memory_order_acquire);
+	int32 RecordsNum = 0;
+	while (ReadPosition < Head)
+	{
+		if (IsPastDeadline(++RecordsNum, Deadline))
+		{
+			break;
+		}
+
+		if (ReadPosition < Header->Tail.load(std::memory_order_acquire))
+		{
+			// Lapped by the writer; what was skipped shows up as a gap in the sequence numbers
+			ReadPosition = Header->Tail.load(std::memory_order_acquire);
+			continue;
+		}
+
+		const uint64 Offset = ReadPosition & (Capacity - 1);
+		FRecord Record;
+		FMemory::Memcpy(&Record, Data + Offset, FMath::Min<uint64>(sizeof(FRecord), Capacity - Offset));
+
+		// Anything read here may be torn, so it's only trusted not to reach out of the ring until checked
+		const bool bIsPadding = Record.Flags & ERecordFlags::Padding;
+		const bool bIsSane = Record.Size >= RecordAlignment && Record.Size <= Capacity - Offset
+			&& Record.Size % RecordAlignment == 0
+			&& (bIsPadding || sizeof(FRecord) + Record.CategoryLen + Record.TextLen <= Record.Size);
+
+		if (bIsSane && !bIsPadding)
+		{
+			Scratch.SetNumUninitialized(Record.CategoryLen + Record.TextLen, EAllowShrinking::No);
+			FMemory::Memcpy(Scratch.GetData(), Data + Offset + sizeof(FRecord), Scratch.Num());
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (ReadPosition < Header->Tail.load(std::memory_order_relaxed))
+		{
+			continue;
+		}
+
+		if (!bIsSane)
+		{
+			// Not torn, so the ring itself is broken; there's nothing to pick up from but the head
+			UE_LOG(LogImGuiOutputLog, Warning, TEXT("Shared log %s is corrupted, skipping to its end"), *Name);
+			ReadPosition = Head;
+			break;
+		}
+
+		ReadPosition += Record.Size;
+		if (bIsPadding)
+		{
+			continue;
+		}
+
+		if (bHasSequence && Record.Sequence > NextSequence)
+		{
+			DroppedMessagesNum += Record.Sequence - NextSequence;
+		}
+
+		NextSequence = Record.Sequence + 1;
+		bHasSequence = true;
+
+		auto& Message = Messages.Add_GetRef(MakeShared<ImGui::Private::TMessage>());
+		Message->bOwnsStrings = false;
+
+		Message->Category = InternCategory(Scratch.GetData(), Record.CategoryLen, Message->CategoryIndex);
+		Message->CategoryLen = Record.CategoryLen;
+
+		Message->Text = Allocate(Record.TextLen + 1);
+		FMemory::Memcpy(Message->Text, Scratch.GetData() + Record.CategoryLen, Record.TextLen);
+		Message->Text[Record.TextLen] = '\0';
+		Message->TextLen = Record.TextLen;
+		Message->FindLineBreaks();
+
+		Message->Verbosity = static_cast<EImGuiLogVerbosity>(Record.Verbosity);
+		Message->Timestamp = FDateTime(Record.Ticks);
+		Message->Sequence = Record.Sequence;
+		Message->Frame = Record.Frame;
+		Message->PlayInEditorId = Record.PlayInEditorId;
+	}
+}
+
+bool FImGuiOutputLogSharedRingReader::IsRing(const uint8* Memory, int64 Size)
+{
+	if (Size < static_cast<int64>(sizeof(FImGuiOutputLogSharedRingHeader)))
+	{
+		return false;
+	}
+
+	const auto* RingHeader = reinterpret_cast<const FImGuiOutputLogSharedRingHeader*>(Memory);
+	return RingHeader->Magic == RingMagic && RingHeader->Version == RingVersion
+		&& FMath::IsPowerOfTwo(RingHeader->Capacity) && RingHeader->Capacity >= MinCapacity
+		&& RingHeader->Capacity <= MaxCapacity
+		&& sizeof(FImGuiOutputLogSharedRingHeader) + RingHeader->Capacity <= static_cast<uint64>(Size);
+}
+
+bool FImGuiOutputLogSharedRingReader::ReadAll(const uint8* Memory, int64 Size,
+	TFunctionRef<void(const FImGuiOutputLogRingRecord&)> Visit)
+{
+	if (!IsRing(Memory, Size))
+	{
+		return false;
+	}
+
+	// Nothing writes to it anymore, so there's nothing to tear either
+	const auto* RingHeader = reinterpret_cast<const FImGuiOutputLogSharedRingHeader*>(Memory);
+	const uint8* RingData = Memory + sizeof(FImGuiOutputLogSharedRingHeader);
+	const uint64 RingCapacity = RingHeader->Capacity;
+	const uint64 Head = RingHeader->Head.load(std::memory_order_relaxed);
+	uint64 Position = RingHeader->Tail.load(std::memory_order_relaxed);
+
+	if (Head < Position || Head - Position > RingCapacity)
+	{
+		return false;
+	}
+
+	while (Position < Head)
+	{
+		const uint64 Offset = Position & (RingCapacity - 1);
+		FRecord Record;
+		FMemory::Memcpy(&Record, RingData + Offset, FMath::Min<uint64>(sizeof(FRecord), RingCapacity - Offset));
+
+		const bool bIsPadding = Record.Flags & ERecordFlags::Padding;
+		const bool bIsSane = Record.Size >= RecordAlignment && Record.Size <= RingCapacity - Offset
+			&& (bIsPadding || sizeof(FRecord) + Record.CategoryLen + Record.TextLen <= Record.Size);
+
+		if (!bIsSane)
+		{
+			// What was read so far is fine, and it's the best there is
+			UE_LOG(LogImGuiOutputLog, Warning, TEXT("Ring is corrupted, the messages after it are lost"));
+			break;
+		}
+
+		if (!bIsPadding)
+		{
+			const char* Payload = reinterpret_cast<const char*>(RingData + Offset + sizeof(FRecord));
+
+			FImGuiOutputLogRingRecord Message;
+			Message.Category = Payload;
+			Message.CategoryLen = Record.CategoryLen;
+			Message.Text = Payload + Record.CategoryLen;
+			Message.TextLen = Record.TextLen;
+			Message.Verbosity = static_cast<EImGuiLogVerbosity>(Record.Verbosity);
+			Message.Ticks = Record.Ticks;
+			Message.Sequence = Record.Sequence;
+			Message.Frame = Record.Frame;
+			Message.PlayInEditorId = Record.PlayInEditorId;
+			Visit(Message);
+		}
+
+		Position += Record.Size;
+	}
+
+	return true;
+}
+
+bool FImGuiOutputLogSharedRingReader::HasNewMessages() const
+{
+	return Header && Header->Head.load(std::memory_order_acquire) != ReadPosition;
+}
+
+const FString& FImGuiOutputLogSharedRingReader::GetName() const
+{
+	return Name;
+}
+
+uint64 FImGuiOutputLogSharedRingReader::GetLagBytes() const
+{
+	return Header ? Header->Head.load(std::memory_order_acquire) - ReadPosition : 0;
+}
+
+uint64 FImGuiOutputLogSharedRingReader::GetLagMessagesNum() const
+{
+	return Header && bHasSequence ? Header->MessagesNum.load(std::memory_order_relaxed) - NextSequence : 0;
+}
+
+uint64 FImGuiOutputLogSharedRingReader::GetDroppedMessagesNum() const
+{
+	return DroppedMessagesNum;
+}
+
+char* FImGuiOutputLogSharedRingReader::Allocate(int32 Len)
+{
+	if (Pages.IsEmpty() || PageUsed + Len > PageSize)
+	{
+		PageSize = FMath::Max(MinPageSize, Len);
+		Pages.Add(MakeUnique<char[]>(PageSize));
+		PageUsed = 0;
+	}
+
+	char* Result = Pages.Last().Get() + PageUsed;
+	PageUsed += Len;
+	return Result;
+}
+
+char* FImGuiOutputLogSharedRingReader::InternCategory(const char* Begin, int32 Len, int32& OutIndex)
+{
+	OutIndex = Categories.IndexOfByPredicate([Begin, Len](const char* Category)
+	{
+		return FCStringAnsi::Strncmp(Category, Begin, Len) == 0 && Category[Len] == '\0';
+	});
+
+	if (OutIndex == INDEX_NONE)
+	{
+		char* Category = Allocate(Len + 1);
+		FMemory::Memcpy(Category, Begin, Len);
+		Category[Len] = '\0';
+		OutIndex = Categories.Add(Category);
+	}
+
+	return Categories[OutIndex];
+}
@@ -0,0 +1,133 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "HAL/PlatformMemory.h"
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+struct FImGuiOutputLogSharedRingHeader;
+
+/** Message as it is in a ring, pointing into it. */
+struct FImGuiOutputLogRingRecord
+{
+public:
+	const char* Category = nullptr;
+	int32 CategoryLen = 0;
+	const char* Text = nullptr;
+	int32 TextLen = 0;
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+	int64 Ticks = 0;
+	uint64 Sequence = 0;
+	uint64 Frame = 0;
+	int32 PlayInEditorId = INDEX_NONE;
+};
+
+/**
+ * Ring buffer in named shared memory the log is written to, so that another process on the same machine, e.g. a viewer
+ * attached to a headless server, can tail it. There's a single writer and any number of readers, and nobody locks.
+ *
+ * Layout, native endian:
+ *   Header   uint32 magic, uint32 version, uint64 capacity, then each on a cache line of its own: uint64 head, the
+ *            position right past the last published record; uint64 tail, the position of the oldest record that
+ *            hasn't been overwritten; uint64 messages num, how many records have ever been published
+ *   Data     capacity bytes, a power of two; positions only ever grow, and are taken modulo the capacity
+ *
+ * Records are 8-byte aligned: uint32 size including the padding, uint16 category length, uint8 verbosity, uint8 flags,
+ * uint64 sequence number, int64 timestamp in ticks, uint64 frame, int32 PIE instance, uint32 text length, and then the
+ * category and the text. A record never wraps around; if it doesn't fit before the end of the data, a padding record,
+ * of which only the first 8 bytes are valid, fills the rest and the record is written at the start.
+ *
+ * The writer moves the tail past the records it's about to overwrite before touching them, and the head once the new
+ * record is complete. A reader copies a record out and then checks the tail: if it has moved past the record, the copy
+ * may be torn, so the reader carries on from the tail and counts the sequence numbers it skipped as dropped.
+ *
+ * The same ring can be kept in a memory-mapped file instead. Writing to it is then as cheap as to memory, and the OS
+ * still writes the pages out if the process dies, so the last messages before a crash survive it.
+ */
+class FImGuiOutputLogSharedRingWriter
+{
+public:
+	~FImGuiOutputLogSharedRingWriter();
+
+	/** Capacity is rounded up to a power of two; more than 2 GB fails, as the records couldn't tell their sizes. */
+	bool Create(const FString& Name, uint64 InCapacity);
+	bool CreateInFile(const FString& Filename, uint64 InCapacity);
+	void Write(const ImGui::Private::TMessage& Message);
+
+private:
+	void Initialize(void* Memory);
+	void Reserve(uint64 Size);
+
+private:
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	void* MappedFile = nullptr;
+	uint64 MappedFileSize = 0;
+	FImGuiOutputLogSharedRingHeader* Header = nullptr;
+	uint8* Data = nullptr;
+	uint64 Capacity = 0;
+
+	// Own copies of what's in the header, which only the writer changes
+	uint64 Head = 0;
+	uint64 Tail = 0;
+	uint64 MessagesNum = 0;
+};
+
+/**
+ * Tails the ring of another process. The messages are copied out of the ring, which is soon overwritten, into pages
+ * owned by the reader, so they're only valid for as long as it's alive.
+ */
+class FImGuiOutputLogSharedRingReader
+{
+public:
+	~FImGuiOutputLogSharedRingReader();
+
+	/** Starts from the oldest message still in the ring. */
+	bool Attach(const FString& InName);
+
+	/** Whether the memory holds a ring, e.g. a file the ring was kept in. */
+	static bool IsRing(const uint8* Memory, int64 Size);
+
+	/** Goes through all the messages of a ring nobody writes to anymore, e.g. the file of a session that crashed. */
+	static bool ReadAll(const uint8* Memory, int64 Size, TFunctionRef<void(const FImGuiOutputLogRingRecord&)> Visit);
+
+	/** Copies out the messages published since the last time, until the deadline. */
+	void Poll(double Deadline);
+	bool HasNewMessages() const;
+
+	const FString& GetName() const;
+
+	/** How far behind the writer the reader is. */
+	uint64 GetLagBytes() const;
+	uint64 GetLagMessagesNum() const;
+
+	/** Messages that were overwritten before the reader got to them. */
+	uint64 GetDroppedMessagesNum() const;
+
+public:
+	TArray<ImGui::Private::TMessageRef> Messages;
+
+private:
+	char* Allocate(int32 Len);
+	char* InternCategory(const char* Begin, int32 Len, int32& OutIndex);
+
+private:
+	FString Name;
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	const FImGuiOutputLogSharedRingHeader* Header = nullptr;
+	const uint8* Data = nullptr;
+	uint64 Capacity = 0;
+
+	uint64 ReadPosition = 0;
+	uint64 NextSequence = 0;
+	bool bHasSequence = false;
+	uint64 DroppedMessagesNum = 0;
+
+	// Record being copied out, before it's known not to be torn
+	TArray<char> Scratch;
+
+	// Messages point at these, so they're only freed along with the reader
+	TArray<TUniquePtr<char[]>> Pages;
+	int32 PageSize = 0;
+	int32 PageUsed = 0;
+	TArray<char*> Categories;
+};
@@ -0,0 +1,180 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogStore.h"
+
+#include "ImGuiOutputLogStats.h"
+#include "ImGui/ImGuiOutputLogDeadline.h"
+#include "ImGui/ImGuiOutputLogFileSource.h"
+#include "Algo/BinarySearch.h"
+
+FImGuiOutputLogStore::FImGuiOutputLogStore(const TSharedRef<const FImGuiOutputLogFileSource>& InFileSource)
+	: FileSource(InFileSource)
+{
+	Categories.Append(InFileSource->GetCategories());
+	MadeMessages.SetNum(MadeMessagesNum);
+}
+
+void FImGuiOutputLogStore::Add(const ImGui::Private::TMessageRef& Message)
+{
+	check(!FileSource);
+
+	FirstLines.Add(Lines.Num());
+	Ticks.Add(Message->Timestamp.GetTicks());
+	Frames.Add(Message->Frame);
+
+	const int32 LinesNum = Message->GetLinesNum();
+	for (int32 i = 0; i < LinesNum; ++i)
+	{
+		Lines.Add({ Message,i });
+	}
+
+	// Most messages know their category index, so that only the ones without it have to be compared
+	bool bIsCategoryPresent = false;
+	if (Message->CategoryIndex != INDEX_NONE)
+	{
+		if (Message->CategoryIndex >= KnownCategoryIndices.Num())
+		{
+			KnownCategoryIndices.Add(false, Message->CategoryIndex + 1 - KnownCategoryIndices.Num());
+		}
+
+		bIsCategoryPresent = KnownCategoryIndices[Message->CategoryIndex];
+		KnownCategoryIndices[Message->CategoryIndex] = true;
+	}
+	else
+	{
+		for (const char* Category : Categories)
+		{
+			if (ImStricmp(Category, Message->Category) == 0)
+			{
+				bIsCategoryPresent = true;
+				break;
+			}
+		}
+	}
+
+	if (!bIsCategoryPresent)
+	{
+		Categories.Add(Message->Category);
+	}
+
+	Messages.Add(Message);
+}
+
+void FImGuiOutputLogStore::AddNewMessages(const TArray<ImGui::Private::TMessageRef>& Source, double Deadline)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiOutputLog_AddNewMessages);
+
+	const int32 Num = Source.Num();
+	int32 i = Messages.Num();
+	while (i < Num)
+	{
+		Add(Source[i++]);
+
+		if (IsPastDeadline(i, Deadline))
+		{
+			break;
+		}
+	}
+}
+
+ImGui::Private::TMessageRef FImGuiOutputLogStore::GetStoredMessage(int32 Index) const
+{
+	if (!FileSource)
+	{
+		return Messages[Index];
+	}
+
+	TSharedPtr<ImGui::Private::TMessage>& Made = MadeMessages[Index % MadeMessagesNum];
+	if (Made && Made->Sequence == static_cast<uint64>(Index))
+	{
+		return Made.ToSharedRef();
+	}
+
+	// Made again in place once nobody holds on to it, so that filtering the file doesn't allocate for every message
+	if (!Made || !Made.IsUnique())
+	{
+		Made = MakeShared<ImGui::Private::TMessage>();
+	}
+
+	FileSource->MakeMessage(Index, *Made);
+	return Made.ToSharedRef();
+}
+
+TPair<ImGui::Private::TMessageRef, int32> FImGuiOutputLogStore::GetLine(int32 Line) const
+{
+	if (!FileSource)
+	{
+		return Lines[Line];
+	}
+
+	const int32 Index = FindMessageOfLine(Line);
+	return { GetStoredMessage(Index), Line - GetFirstLine(Index) };
+}
+
+int32 FImGuiOutputLogStore::FindMessage(uint64 Sequence) const
+{
+	// The messages of a file are numbered by their index
+	if (FileSource)
+	{
+		return static_cast<int32>(FMath::Min<uint64>(Sequence, GetMessagesNum()));
+	}
+
+	return Algo::LowerBoundBy(Messages, Sequence,
+		[](const ImGui::Private::TMessageRef& Message) { return Message->Sequence; });
+}
+
+int32 FImGuiOutputLogStore::FindMessageOfLine(int32 Line) const
+{
+	return Algo::UpperBound(FileSource ? FileSource->GetColumns().FirstLines : FirstLines, Line) - 1;
+}
+
+int32 FImGuiOutputLogStore::GetFirstLine(int32 MessageIndex) const
+{
+	if (FileSource)
+	{
+		return FileSource->GetColumns().GetFirstLine(MessageIndex);
+	}
+
+	return MessageIndex < FirstLines.Num() ? FirstLines[MessageIndex] : Lines.Num();
+}
+
+void FImGuiOutputLogStore::FindSpan(const FImGuiOutputLogFilter::FRange& Range, int32& OutBegin, int32& OutEnd) const
+{
+	OutBegin = FMath::Max(
+		Algo::LowerBound(GetTicks(), Range.MinTicks),
+		Algo::LowerBound(GetFrames(), Range.MinFrame));
+
+	OutEnd = FMath::Min(
+		Algo::UpperBound(GetTicks(), Range.MaxTicks),
+		Algo::UpperBound(GetFrames(), Range.MaxFrame));
+
+	OutEnd = FMath::Max(OutBegin, OutEnd);
+}
+
+int32 FImGuiOutputLogStore::GetMessagesNum() const
+{
+	return FileSource ? FileSource->GetMessagesNum() : Messages.Num();
+}
+
+int32 FImGuiOutputLogStore::GetLinesNum() const
+{
+	return FileSource ? FileSource->GetColumns().GetLinesNum() : Lines.Num();
+}
+
+SIZE_T FImGuiOutputLogStore::GetAllocatedSize() const
+{
+	const SIZE_T FileSize = FileSource ? FileSource->GetColumns().GetAllocatedSize() : 0;
+	return Messages.GetAllocatedSize() + Lines.GetAllocatedSize() + Categories.GetAllocatedSize()
+		+ FirstLines.GetAllocatedSize() + Ticks.GetAllocatedSize() + Frames.GetAllocatedSize()
+		+ KnownCategoryIndices.GetAllocatedSize() + MadeMessages.GetAllocatedSize() + FileSize;
+}
+
+const TArray<int64>& FImGuiOutputLogStore::GetTicks() const
+{
+	return FileSource ? FileSource->GetColumns().Ticks : Ticks;
+}
+
+const TArray<uint64>& FImGuiOutputLogStore::GetFrames() const
+{
+	return FileSource ? FileSource->GetColumns().Frames : Frames;
+}
@@ -0,0 +1,72 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogFilter.h"
+#include "ImGui/ImGuiOutputLogMessage.h"
+
+class FImGuiOutputLogFileSource;
+
+/**
+ * Append-only list of messages and their lines, shared by all the log views that show the same source. Nothing is
+ * ever removed or changed once added, so a view only has to remember how far it got and which lines passed its filter.
+ *
+ * The messages are mirrored in the order of their source, so an index into the store is an index into the source too.
+ *
+ * The store of a file has all of it from the start, and reads the columns of the file instead of keeping anything per
+ * message or line; objects are only made of the messages that are asked for.
+ */
+class FImGuiOutputLogStore
+{
+public:
+	FImGuiOutputLogStore() = default;
+	explicit FImGuiOutputLogStore(const TSharedRef<const FImGuiOutputLogFileSource>& InFileSource);
+
+	void Add(const ImGui::Private::TMessageRef& Message);
+
+	/** Adds the messages of the source that aren't in the store yet, until the deadline. */
+	void AddNewMessages(const TArray<ImGui::Private::TMessageRef>& Source, double Deadline);
+
+	ImGui::Private::TMessageRef GetStoredMessage(int32 Index) const;
+
+	/** Message the line belongs to, and the index of the line within it. */
+	TPair<ImGui::Private::TMessageRef, int32> GetLine(int32 Line) const;
+
+	/** Index of the message of the sequence, or of the first one after it if it isn't in the store. */
+	int32 FindMessage(uint64 Sequence) const;
+	int32 FindMessageOfLine(int32 Line) const;
+
+	/** Index of the first line of the message; the number of lines for the one past the last. */
+	int32 GetFirstLine(int32 MessageIndex) const;
+
+	/** Messages logged within the range; they come in the order they were logged, so it's a binary search. */
+	void FindSpan(const FImGuiOutputLogFilter::FRange& Range, int32& OutBegin, int32& OutEnd) const;
+
+	int32 GetMessagesNum() const;
+	int32 GetLinesNum() const;
+	SIZE_T GetAllocatedSize() const;
+
+public:
+	// Every category in the order it was first seen; views pick up the ones they haven't seen yet
+	TArray<const char*> Categories;
+
+private:
+	const TArray<int64>& GetTicks() const;
+	const TArray<uint64>& GetFrames() const;
+
+private:
+	TArray<ImGui::Private::TMessageRef> Messages;
+	TArray<TPair<ImGui::Private::TMessageRef, int32>> Lines;
+	TArray<int32> FirstLines;
+	TArray<int64> Ticks;
+	TArray<uint64> Frames;
+
+	TBitArray<> KnownCategoryIndices;
+
+	TSharedPtr<const FImGuiOutputLogFileSource> FileSource;
+
+	// Messages of the file made lately, e.g. the visible ones, so that they aren't made again every frame. A file has a
+	// store per view, and a view is only used by one thread at a time, so nothing else gets at these
+	static constexpr int32 MadeMessagesNum = 1024;
+	mutable TArray<TSharedPtr<ImGui::Private::TMessage>> MadeMessages;
+};
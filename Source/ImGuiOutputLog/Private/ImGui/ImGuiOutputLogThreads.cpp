@@ -0,0 +1,68 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogThreads.h"
+
+#include "imgui_internal.h"
+#include "HAL/ThreadManager.h"
+
+FImGuiOutputLogThreads::~FImGuiOutputLogThreads()
+{
+	for (const FThread& Thread : Threads)
+	{
+		free(Thread.Name);
+	}
+}
+
+FImGuiOutputLogThreads& FImGuiOutputLogThreads::Get()
+{
+	static FImGuiOutputLogThreads Instance;
+	return Instance;
+}
+
+int32 FImGuiOutputLogThreads::GetCurrentThreadIndex()
+{
+	static thread_local const int32 Index = Register();
+	return Index;
+}
+
+const char* FImGuiOutputLogThreads::GetName(int32 Index)
+{
+	uint32 Id;
+	{
+		FScopeLock Lock(&ThreadsCritical);
+		if (Threads[Index].Name)
+		{
+			return Threads[Index].Name;
+		}
+
+		Id = Threads[Index].Id;
+	}
+
+	// Looked up outside of the lock, as the thread manager takes its own
+	FString Name = FThreadManager::GetThreadName(Id);
+	if (Name.IsEmpty())
+	{
+		Name = FString::Printf(TEXT("Thread %u"), Id);
+	}
+
+	// Another thread may have looked it up in the meantime; names are never freed, so either can be handed out
+	FScopeLock Lock(&ThreadsCritical);
+	if (!Threads[Index].Name)
+	{
+		Threads[Index].Name = ImStrdup(TCHAR_TO_ANSI(*Name));
+	}
+
+	return Threads[Index].Name;
+}
+
+int32 FImGuiOutputLogThreads::Num() const
+{
+	FScopeLock Lock(&ThreadsCritical);
+	return Threads.Num();
+}
+
+int32 FImGuiOutputLogThreads::Register()
+{
+	FScopeLock Lock(&ThreadsCritical);
+	return Threads.Add({ FPlatformTLS::GetCurrentThreadId(), nullptr });
+}
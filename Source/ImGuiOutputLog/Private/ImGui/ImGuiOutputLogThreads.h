@@ -0,0 +1,38 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+/**
+ * Threads that have logged since the engine started. Each gets a small index the first time it logs, kept in its TLS,
+ * so that tagging a message costs next to nothing and filters can keep a bit per thread. Names are only looked up once
+ * something displays them, as most threads are never looked at.
+ */
+class FImGuiOutputLogThreads
+{
+public:
+	~FImGuiOutputLogThreads();
+
+	static FImGuiOutputLogThreads& Get();
+
+	/** Index of the calling thread. Any thread. */
+	int32 GetCurrentThreadIndex();
+
+	/** Name of the thread, or its ID if the thread manager doesn't know it. Any thread, e.g. filters on workers. */
+	const char* GetName(int32 Index);
+
+	int32 Num() const;
+
+private:
+	int32 Register();
+
+private:
+	struct FThread
+	{
+	public:
+		uint32 Id = 0;
+		char* Name = nullptr;
+	};
+
+	TArray<FThread> Threads;
+	mutable FCriticalSection ThreadsCritical;
+};
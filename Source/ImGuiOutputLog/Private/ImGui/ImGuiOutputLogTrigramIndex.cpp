@@ -0,0 +1,194 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogTrigramIndex.h"
+
+#include "ImGui/ImGuiOutputLogColdStore.h"
+#include "ImGuiOutputLogStats.h"
+
+// Small enough for the lock not to be held for long, big enough for the task not to cost more than the work
+static constexpr int32 BatchSize = 256;
+
+static uint32 MakeTrigram(const char* Text)
+{
+	return static_cast<uint32>(static_cast<uint8>(FCharAnsi::ToLower(Text[0]))) << 16
+		| static_cast<uint32>(static_cast<uint8>(FCharAnsi::ToLower(Text[1]))) << 8
+		| static_cast<uint32>(static_cast<uint8>(FCharAnsi::ToLower(Text[2])));
+}
+
+static void Intersect(TArray<int32>& InOut, const TArray<int32>& Other)
+{
+	int32 Out = 0;
+	for (int32 i = 0, j = 0; i < InOut.Num() && j < Other.Num();)
+	{
+		if (InOut[i] < Other[j])
+		{
+			i++;
+		}
+		else if (InOut[i] > Other[j])
+		{
+			j++;
+		}
+		else
+		{
+			InOut[Out++] = InOut[i];
+			i++;
+			j++;
+		}
+	}
+
+	InOut.SetNum(Out, EAllowShrinking::No);
+}
+
+FImGuiOutputLogTrigramIndex::~FImGuiOutputLogTrigramIndex()
+{
+	Task.Wait();
+}
+
+void FImGuiOutputLogTrigramIndex::Update(const TArray<ImGui::Private::TMessageRef>& Messages)
+{
+	const int32 NewMessagesNum = Messages.Num() - QueuedNum;
+	if (NewMessagesNum < BatchSize || !Task.IsCompleted())
+	{
+		return;
+	}
+
+	// The worker only gets to see a copy, as the buffer keeps growing meanwhile
+	TArray<ImGui::Private::TMessageRef> NewMessages(Messages.GetData() + QueuedNum, NewMessagesNum);
+	const int32 FirstIndex = QueuedNum;
+	QueuedNum = Messages.Num();
+
+	FImGuiOutputLogColdStore::Get().AddReader();
+
+	Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, FirstIndex, NewMessages = MoveTemp(NewMessages)]
+	{
+		LLM_SCOPE_BYTAG(ImGuiOutputLog);
+
+		for (int32 BatchBegin = 0; BatchBegin < NewMessages.Num(); BatchBegin += BatchSize)
+		{
+			const int32 BatchEnd = FMath::Min(BatchBegin + BatchSize, NewMessages.Num());
+
+			FWriteScopeLock WriteLock(Lock);
+			for (int32 i = BatchBegin; i < BatchEnd; ++i)
+			{
+				IndexMessage(FirstIndex + i, *NewMessages[i]);
+			}
+
+			IndexedNum = FirstIndex + BatchEnd;
+		}
+
+		FImGuiOutputLogColdStore::Get().RemoveReader();
+	}, UE::Tasks::ETaskPriority::BackgroundLow);
+}
+
+bool FImGuiOutputLogTrigramIndex::FindCandidates(const char* Begin, const char* End, TArray<int32>& OutCandidates,
+	int32& OutIndexedNum) const
+{
+	OutCandidates.Reset();
+	if (End - Begin < 3)
+	{
+		return false;
+	}
+
+	FReadScopeLock ReadLock(Lock);
+	OutIndexedNum = IndexedNum;
+
+	TArray<const FPostingList*> Lists;
+	for (const char* It = Begin; It + 3 <= End; ++It)
+	{
+		const FPostingList* List = PostingLists.Find(MakeTrigram(It));
+		if (!List)
+		{
+			// Nothing has this trigram, so nothing can contain the text
+			return true;
+		}
+
+		Lists.AddUnique(List);
+	}
+
+	// Starting from the shortest list keeps all intermediate results as small as possible
+	Lists.Sort([](const FPostingList& Lhs, const FPostingList& Rhs)
+	{
+		return Lhs.Num < Rhs.Num;
+	});
+
+	Decode(*Lists[0], OutCandidates);
+
+	TArray<int32> Decoded;
+	for (int32 i = 1; i < Lists.Num() && OutCandidates.Num() > 0; ++i)
+	{
+		Decode(*Lists[i], Decoded);
+		Intersect(OutCandidates, Decoded);
+	}
+
+	return true;
+}
+
+int32 FImGuiOutputLogTrigramIndex::GetIndexedNum() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return IndexedNum;
+}
+
+SIZE_T FImGuiOutputLogTrigramIndex::GetAllocatedSize() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return PostingLists.GetAllocatedSize() + PostingsSize;
+}
+
+void FImGuiOutputLogTrigramIndex::IndexMessage(int32 Index, const ImGui::Private::TMessage& Message)
+{
+	const FImGuiOutputLogText Text = Message.GetText();
+	IndexText(Index, Text.Begin, Text.End);
+	IndexText(Index, Message.Category, Message.Category + Message.CategoryLen);
+}
+
+void FImGuiOutputLogTrigramIndex::IndexText(int32 Index, const char* Begin, const char* End)
+{
+	for (const char* It = Begin; It + 3 <= End; ++It)
+	{
+		FPostingList& List = PostingLists.FindOrAdd(MakeTrigram(It));
+
+		// The same trigram may appear many times in a message, but the message has to be listed once
+		if (List.Last == Index)
+		{
+			continue;
+		}
+
+		const SIZE_T PreviousSize = List.Deltas.GetAllocatedSize();
+
+		uint32 Delta = Index - List.Last;
+		while (Delta >= 0x80)
+		{
+			List.Deltas.Add(static_cast<uint8>(Delta) | 0x80);
+			Delta >>= 7;
+		}
+
+		List.Deltas.Add(static_cast<uint8>(Delta));
+		List.Last = Index;
+		List.Num++;
+
+		PostingsSize += List.Deltas.GetAllocatedSize() - PreviousSize;
+	}
+}
+
+void FImGuiOutputLogTrigramIndex::Decode(const FPostingList& List, TArray<int32>& Out)
+{
+	Out.Reset(List.Num);
+
+	int32 Value = INDEX_NONE;
+	uint32 Delta = 0;
+	int32 Shift = 0;
+	for (const uint8 Byte : List.Deltas)
+	{
+		Delta |= static_cast<uint32>(Byte & 0x7F) << Shift;
+		Shift += 7;
+
+		if ((Byte & 0x80) == 0)
+		{
+			Value += Delta;
+			Out.Add(Value);
+			Delta = 0;
+			Shift = 0;
+		}
+	}
+}
@@ -0,0 +1,55 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiOutputLogMessage.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+/**
+ * Case-insensitive trigram index over the texts and categories of the captured messages, used to find the messages
+ * that may contain some text without looking at all of them.
+ *
+ * New messages are indexed in batches on a worker. Messages are referred to by their index in the buffer, and the
+ * postings of every trigram are stored as varint deltas between them.
+ */
+class FImGuiOutputLogTrigramIndex
+{
+public:
+	~FImGuiOutputLogTrigramIndex();
+
+	/** Hands the messages that haven't been indexed yet to the worker, unless it's still busy. Game thread only. */
+	void Update(const TArray<ImGui::Private::TMessageRef>& Messages);
+
+	/**
+	 * Finds the messages among the first OutIndexedNum that contain all trigrams of the text. The result is sorted.
+	 * Fails if the text is too short to have any trigrams.
+	 */
+	bool FindCandidates(const char* Begin, const char* End, TArray<int32>& OutCandidates, int32& OutIndexedNum) const;
+
+	int32 GetIndexedNum() const;
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FPostingList
+	{
+	public:
+		TArray<uint8> Deltas;
+		int32 Last = INDEX_NONE;
+		int32 Num = 0;
+	};
+
+	void IndexMessage(int32 Index, const ImGui::Private::TMessage& Message);
+	void IndexText(int32 Index, const char* Begin, const char* End);
+	static void Decode(const FPostingList& List, TArray<int32>& Out);
+
+private:
+	mutable FRWLock Lock;
+	TMap<uint32, FPostingList> PostingLists;
+	int32 IndexedNum = 0;
+	std::atomic<SIZE_T> PostingsSize = 0;
+
+	int32 QueuedNum = 0;
+	UE::Tasks::FTask Task;
+};
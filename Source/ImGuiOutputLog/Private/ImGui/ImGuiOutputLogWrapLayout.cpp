@@ -0,0 +1,106 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#include "ImGui/ImGuiOutputLogWrapLayout.h"
+
+#include "Algo/BinarySearch.h"
+
+bool FImGuiOutputLogWrapLayout::Prepare(float InWidth)
+{
+	const ImFont* CurrentFont = ImGui::GetFont();
+	const float CurrentFontSize = ImGui::GetFontSize();
+	if (Width == InWidth && Font == CurrentFont && FontSize == CurrentFontSize)
+	{
+		return false;
+	}
+
+	Width = InWidth;
+	Font = CurrentFont;
+	FontSize = CurrentFontSize;
+
+	// The texts are single-byte, so every glyph they can have fits in the table
+	const float Scale = FontSize / Font->FontSize;
+	for (int32 Char = 0; Char < UE_ARRAY_COUNT(Advances); ++Char)
+	{
+		Advances[Char] = Font->GetCharAdvance(static_cast<ImWchar>(Char)) * Scale;
+	}
+
+	Reset();
+	return true;
+}
+
+void FImGuiOutputLogWrapLayout::Reset()
+{
+	FirstRows.Reset();
+	LaidOutRowsNum = 0;
+}
+
+void FImGuiOutputLogWrapLayout::Add(float UsedWidth, const char* Begin, const char* End)
+{
+	FirstRows.Add(LaidOutRowsNum);
+
+	do
+	{
+		Begin = FindRowEnd(Begin, End, UsedWidth);
+		UsedWidth = 0.f;
+		LaidOutRowsNum++;
+	}
+	while (Begin < End);
+}
+
+int32 FImGuiOutputLogWrapLayout::GetLaidOutNum() const
+{
+	return FirstRows.Num();
+}
+
+int32 FImGuiOutputLogWrapLayout::GetRowsNum(int32 LinesNum) const
+{
+	return GetFirstRow(LinesNum);
+}
+
+int32 FImGuiOutputLogWrapLayout::GetFirstRow(int32 Line) const
+{
+	return Line < FirstRows.Num() ? FirstRows[Line] : LaidOutRowsNum + Line - FirstRows.Num();
+}
+
+int32 FImGuiOutputLogWrapLayout::FindLine(int32 Row) const
+{
+	if (Row >= LaidOutRowsNum)
+	{
+		return FirstRows.Num() + Row - LaidOutRowsNum;
+	}
+
+	return Algo::UpperBound(FirstRows, Row) - 1;
+}
+
+float FImGuiOutputLogWrapLayout::GetTextWidth(const char* Begin, const char* End) const
+{
+	float Result = 0.f;
+	for (const char* It = Begin; It < End; ++It)
+	{
+		Result += Advances[static_cast<uint8>(*It)];
+	}
+
+	return Result;
+}
+
+const char* FImGuiOutputLogWrapLayout::FindRowEnd(const char* Begin, const char* End, float UsedWidth) const
+{
+	const char* LastSpace = nullptr;
+	float RowWidth = UsedWidth;
+	for (const char* It = Begin; It < End; ++It)
+	{
+		RowWidth += Advances[static_cast<uint8>(*It)];
+		if (RowWidth > Width)
+		{
+			// A row always takes at least one character, or it would never end
+			return LastSpace ? LastSpace + 1 : FMath::Max(It, Begin + 1);
+		}
+
+		if (*It == ' ' || *It == '\t')
+		{
+			LastSpace = It;
+		}
+	}
+
+	return End;
+}
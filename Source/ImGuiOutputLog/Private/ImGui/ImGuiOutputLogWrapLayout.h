@@ -0,0 +1,43 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "imgui.h"
+
+/**
+ * Rows the displayed lines take when they're wrapped to the width of the log.
+ *
+ * The first row of each line is kept as a prefix sum, so the clipper can work in rows, and a row is mapped back to its
+ * line by binary search. Text is measured with a table of glyph advances rather than through ImGui, and lines are laid
+ * out a budget at a time; the ones that haven't been yet count as a single row until they are.
+ */
+class FImGuiOutputLogWrapLayout
+{
+public:
+	/** Starts over if the width or the font have changed since the lines were laid out. Returns whether it did. */
+	bool Prepare(float InWidth);
+	void Reset();
+
+	/** Lays out the next line; its first row starts after UsedWidth, e.g. taken by the elements in front of it. */
+	void Add(float UsedWidth, const char* Begin, const char* End);
+
+	int32 GetLaidOutNum() const;
+	int32 GetRowsNum(int32 LinesNum) const;
+	int32 GetFirstRow(int32 Line) const;
+	int32 FindLine(int32 Row) const;
+
+	float GetTextWidth(const char* Begin, const char* End) const;
+
+	/** End of the row that starts at Begin; it's broken after the last space that fits, or wherever it has to. */
+	const char* FindRowEnd(const char* Begin, const char* End, float UsedWidth) const;
+
+private:
+	float Width = 0.f;
+	const ImFont* Font = nullptr;
+	float FontSize = 0.f;
+	float Advances[256] = {};
+
+	// First row of each laid out line, and how many rows they take altogether
+	TArray<int32> FirstRows;
+	int32 LaidOutRowsNum = 0;
+};
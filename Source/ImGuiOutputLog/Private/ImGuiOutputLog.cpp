@@ -1,3 +1,23 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ImGuiOutputLog.h"
+
+#include "ImGuiOutputLogStats.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogImGuiOutputLog);
+
+DEFINE_STAT(STAT_ImGuiOutputLog_Serialize);
+DEFINE_STAT(STAT_ImGuiOutputLog_AddNewMessages);
+DEFINE_STAT(STAT_ImGuiOutputLog_ValidateMessages);
+DEFINE_STAT(STAT_ImGuiOutputLog_FilterMessages);
+DEFINE_STAT(STAT_ImGuiOutputLog_DrawMessages);
+DEFINE_STAT(STAT_ImGuiOutputLog_MessagesPerSecond);
+DEFINE_STAT(STAT_ImGuiOutputLog_StoredBytes);
+DEFINE_STAT(STAT_ImGuiOutputLog_Lines);
+DEFINE_STAT(STAT_ImGuiOutputLog_FilteredLines);
+DEFINE_STAT(STAT_ImGuiOutputLog_RefilterTime);
+
+LLM_DEFINE_TAG(ImGuiOutputLog);
 	
 IMPLEMENT_MODULE(FDefaultModuleImpl, ImGuiOutputLog)
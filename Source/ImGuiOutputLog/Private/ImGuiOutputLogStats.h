@@ -0,0 +1,29 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ImGuiOutputLog"), STATGROUP_ImGuiOutputLog, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Serialize"), STAT_ImGuiOutputLog_Serialize, STATGROUP_ImGuiOutputLog, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add New Messages"), STAT_ImGuiOutputLog_AddNewMessages, STATGROUP_ImGuiOutputLog, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Validate Messages"), STAT_ImGuiOutputLog_ValidateMessages, STATGROUP_ImGuiOutputLog, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Filter Messages"), STAT_ImGuiOutputLog_FilterMessages, STATGROUP_ImGuiOutputLog, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Draw Messages"), STAT_ImGuiOutputLog_DrawMessages, STATGROUP_ImGuiOutputLog, );
+
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Messages/s"), STAT_ImGuiOutputLog_MessagesPerSecond,
+	STATGROUP_ImGuiOutputLog, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Stored Texts"), STAT_ImGuiOutputLog_StoredBytes, STATGROUP_ImGuiOutputLog, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Lines"), STAT_ImGuiOutputLog_Lines, STATGROUP_ImGuiOutputLog, );
+
+// Summed over the views of every open log, so it's cleared every frame and added to by each of them
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Filtered Lines (All Views)"), STAT_ImGuiOutputLog_FilteredLines,
+	STATGROUP_ImGuiOutputLog, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Refilter (ms)"), STAT_ImGuiOutputLog_RefilterTime,
+	STATGROUP_ImGuiOutputLog, );
+
+// Everything the plugin allocates, from the messages to what the views keep about them
+LLM_DECLARE_TAG(ImGuiOutputLog);
@@ -14,6 +14,31 @@ enum EImGuiOutputLogMessageElement : uint8
 	Category	= 1 << 0,
 	Timestamp	= 1 << 1,
 	Verbosity	= 1 << 2,
+	Thread		= 1 << 3,
+};
+
+/** Message to be notified about as soon as it's logged, whether or not a log is open. */
+USTRUCT()
+struct FImGuiOutputLogAlertRule
+{
+	GENERATED_BODY()
+
+public:
+	/** Text the message has to contain, case insensitive. Empty matches all messages of the category and verbosity. */
+	UPROPERTY(EditAnywhere)
+	FString Pattern;
+
+	/** Category the message has to be of, where * and ? are wildcards. Empty matches all categories. */
+	UPROPERTY(EditAnywhere)
+	FString Category;
+
+	/** Least severe verbosity that still matches. */
+	UPROPERTY(EditAnywhere)
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::VeryVerbose;
+
+	/** Show the message on screen, besides broadcasting it. */
+	UPROPERTY(EditAnywhere)
+	bool bShowToast = true;
 };
 
 UCLASS(DisplayName="ImGui Engine Output Log")
@@ -61,6 +86,28 @@ public:
 	UFUNCTION(BlueprintPure, Category="ImGui|Engine Log")
 	TEnumAsByte<EImGuiOutputLogMessageElement> GetDisplayedElements() const;
 
+	/** Only shows the messages logged between the two points in time, both inclusive. */
+	UFUNCTION(BlueprintCallable, Category="ImGui|Engine Log")
+	void SetTimeRange(FDateTime From, FDateTime To);
+
+	/** Only shows the messages logged on the frames between the two, both inclusive. A negative To leaves it open. */
+	UFUNCTION(BlueprintCallable, Category="ImGui|Engine Log")
+	void SetFrameRange(int64 From, int64 To);
+
+	UFUNCTION(BlueprintCallable, Category="ImGui|Engine Log")
+	void ClearRange();
+
+	/** Total CPU time, in seconds, spent on indexing messages on workers while the log was hidden. */
+	UFUNCTION(BlueprintPure, Category="ImGui|Engine Log")
+	float GetHiddenIndexingTime() const;
+
+	/**
+	 * Total time, in seconds, the game thread spent on the log while it was hidden: adding new messages to the store
+	 * and starting the workers. This is what being hidden still costs the frame.
+	 */
+	UFUNCTION(BlueprintPure, Category="ImGui|Engine Log")
+	float GetHiddenGameThreadTime() const;
+
 public:
 	FSimpleMulticastDelegate OnClosedDelegate;
 
@@ -80,6 +127,9 @@ public:
 
 	//~UDeveloperSettings Interface
 	virtual FName GetCategoryName() const override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 	//~End of UDeveloperSettings Interface
 
 public:
@@ -88,4 +138,54 @@ public:
 
 	UPROPERTY(Config, EditAnywhere)
 	bool bEnabledInputOnActive = true;
+
+	/** How long the log window may spend per frame on formatting and filtering new messages. */
+	UPROPERTY(Config, EditAnywhere, meta=(ClampMin="0.1", Units="ms"))
+	float IngestionBudgetMs = 1.f;
+
+	/** Keep formatting, filtering and collecting categories on a worker while the log is hidden, so opening it is instant. */
+	UPROPERTY(Config, EditAnywhere)
+	bool bIndexWhileHidden = true;
+
+	/** How many of the latest messages keep their text as is; the texts of older ones are compressed. 0 keeps all. */
+	UPROPERTY(Config, EditAnywhere, meta=(ClampMin="0"))
+	int32 MaxHotMessages = 200000;
+
+	/** Index the texts of the messages by trigrams, so the search needn't go through all of them. Costs memory. */
+	UPROPERTY(Config, EditAnywhere)
+	bool bBuildSearchIndex = false;
+
+	/**
+	 * Also write the log to a ring in shared memory under this name, so that another process on the machine can attach
+	 * to it. Empty disables it. -ImGuiLogShm=Name on the command line takes precedence.
+	 */
+	UPROPERTY(Config, EditAnywhere)
+	FString SharedLogName;
+
+	/** Size of the shared memory ring; once it's full, the oldest messages are overwritten. */
+	UPROPERTY(Config, EditAnywhere, meta=(ClampMin="1", ClampMax="2048", Units="Megabytes"))
+	int32 SharedLogSizeMB = 16;
+
+	/**
+	 * Keep the latest messages in a memory-mapped file, which the OS writes out even if the process dies. The one of the
+	 * previous session can be opened from Open Log File...
+	 */
+	UPROPERTY(Config, EditAnywhere)
+	bool bKeepCrashLog = false;
+
+	UPROPERTY(Config, EditAnywhere,
+		meta=(ClampMin="1", ClampMax="2048", Units="Megabytes", EditCondition="bKeepCrashLog"))
+	int32 CrashLogSizeMB = 8;
+
+	/** Messages that are broadcast through FImGuiOutputLogAlerts as they're logged, and optionally shown on screen. */
+	UPROPERTY(Config, EditAnywhere)
+	TArray<FImGuiOutputLogAlertRule> AlertRules;
+
+	/** How long a rule stays quiet on screen after showing a message; it's still broadcast every time. */
+	UPROPERTY(Config, EditAnywhere, meta=(ClampMin="0", Units="s"))
+	float AlertToastCooldown = 5.f;
+
+	/** Frames that take longer than this are listed under Hitches, along with how much was logged during them. */
+	UPROPERTY(Config, EditAnywhere, meta=(ClampMin="1", Units="ms"))
+	float HitchThresholdMs = 50.f;
 };
@@ -4,7 +4,7 @@
 
 #include "ImGuiLogVerbosity.generated.h"
 
-UENUM()
+UENUM(BlueprintType)
 enum class EImGuiLogVerbosity : uint8
 {
 	Fatal = ELogVerbosity::Type::Fatal,
@@ -0,0 +1,70 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "ImGui/ImGuiLogVerbosity.h"
+#include "Tasks/Task.h"
+
+struct FImGuiOutputLogAlertRule;
+struct FImGuiOutputLogMessage;
+
+/** Message that matched an alert rule. */
+struct FImGuiOutputLogAlert
+{
+public:
+	/** Index of the rule in the settings. */
+	int32 RuleIndex = INDEX_NONE;
+
+	FString Text;
+	FString Category;
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+	FDateTime Timestamp;
+	uint64 Frame = 0;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiOutputLogAlertDelegate, const FImGuiOutputLogAlert&);
+
+/**
+ * Matches the messages of the log against the alert rules of the settings as they're logged. The patterns of all rules
+ * are compiled into a single Aho-Corasick automaton, so a message is gone through once however many rules there are.
+ * The matching is done on a worker, a batch of messages per frame, and the alerts are broadcast on the game thread.
+ */
+class IMGUIOUTPUTLOG_API FImGuiOutputLogAlerts
+{
+public:
+	~FImGuiOutputLogAlerts();
+
+	static FImGuiOutputLogAlerts& Get();
+
+	/** Replaces the rules; they apply to the messages added from then on. Game thread only. */
+	void SetRules(const TArray<FImGuiOutputLogAlertRule>& InRules);
+
+	/** Queues the message to be matched on the next frame. Game thread only. */
+	void Add(const TSharedRef<FImGuiOutputLogMessage>& Message);
+
+	/** Drops the rules and what's queued, and waits for the worker. */
+	void Reset();
+
+public:
+	FImGuiOutputLogAlertDelegate OnAlertDelegate;
+
+private:
+	bool Tick(float DeltaTime);
+	void Match(const TArray<TSharedRef<FImGuiOutputLogMessage>>& Messages);
+	void Broadcast(TArray<FImGuiOutputLogAlert>&& Alerts);
+
+private:
+	TUniquePtr<class FImGuiOutputLogAlertMatcher> Matcher;
+	TBitArray<> ToastRules;
+
+	TArray<TSharedRef<FImGuiOutputLogMessage>> Pending;
+	UE::Tasks::FTask Task;
+	FTSTicker::FDelegateHandle Ticker;
+
+	// Written by the task, broadcast once it's done
+	TArray<FImGuiOutputLogAlert> Results;
+
+	// When each rule last showed a message on screen
+	TArray<double> LastToastTimes;
+};
@@ -0,0 +1,128 @@
+// Author: Antonio Sidenko (Tonetfal), June 2025
+
+#pragma once
+
+#include "ImGui/ImGuiLogVerbosity.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "ImGuiOutputLogQuery.generated.h"
+
+struct FImGuiOutputLogMessage;
+
+/** What to take from the log; the same criteria the log window has. */
+struct FImGuiOutputLogQueryParams
+{
+public:
+	/** Written as in the search box, e.g. "cat:LogNet* lvl>=Warning timeout". */
+	FString Query;
+
+	/** Indices of the messages since the start of the log, the last one exclusive. */
+	int32 BeginIndex = 0;
+	int32 EndIndex = MAX_int32;
+
+	/** Both inclusive. */
+	FDateTime MinTime = FDateTime::MinValue();
+	FDateTime MaxTime = FDateTime::MaxValue();
+	uint64 MinFrame = 0;
+	uint64 MaxFrame = MAX_uint64;
+
+	/** PIE instance whose messages to keep, along with the ones logged outside of any; INDEX_NONE keeps all. */
+	int32 PlayInEditorId = INDEX_NONE;
+};
+
+/** Message of a snapshot. The strings point into the log itself, and are valid for as long as the snapshot is. */
+struct FImGuiOutputLogMessageView
+{
+public:
+	int32 Index = INDEX_NONE;
+	FAnsiStringView Text;
+	FAnsiStringView Category;
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+	FDateTime Timestamp;
+	uint64 Frame = 0;
+	int32 PlayInEditorId = INDEX_NONE;
+};
+
+/**
+ * Messages of the log that passed a query, at the time it was taken. Can be taken and read on any thread, and nothing
+ * is copied but references to the messages.
+ *
+ * Holding a snapshot stops the cold tier altogether: no message is moved to it while there are any, as that frees the
+ * texts they point to, so the memory of the log keeps growing with every message logged in the meantime. Snapshots
+ * shouldn't be kept around for longer than it takes to go through them.
+ */
+class IMGUIOUTPUTLOG_API FImGuiOutputLogSnapshot
+{
+public:
+	~FImGuiOutputLogSnapshot();
+
+	/** Null if there's no log, e.g. before the engine is initialized. */
+	static TSharedPtr<FImGuiOutputLogSnapshot> Take(const FImGuiOutputLogQueryParams& Params);
+
+	int32 Num() const;
+	FImGuiOutputLogMessageView operator[](int32 Index) const;
+
+	/** Index right past the last message the log had, which is where the next snapshot can start from. */
+	int32 GetEndIndex() const;
+
+private:
+	FImGuiOutputLogSnapshot() = default;
+
+private:
+	TArray<TSharedRef<FImGuiOutputLogMessage>> Messages;
+	TArray<int32> Indices;
+
+	// Decompressed texts of the cold messages, and the pin of the hot ones if it was taken on the game thread
+	TArray<TSharedPtr<const TArray<char>, ESPMode::ThreadSafe>> Pins;
+	TArray<FAnsiStringView> Texts;
+
+	int32 EndIndex = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FImGuiOutputLogEntry
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	int32 Index = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	FString Text;
+
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	FString Category;
+
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	EImGuiLogVerbosity Verbosity = EImGuiLogVerbosity::Log;
+
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	FDateTime Timestamp;
+
+	UPROPERTY(BlueprintReadOnly, Category="ImGui|Engine Log")
+	int64 Frame = 0;
+};
+
+UCLASS()
+class IMGUIOUTPUTLOG_API UImGuiOutputLogQueryLibrary
+	: public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Messages between the two indices, both inclusive, that match the query. A negative Last goes to the end. */
+	UFUNCTION(BlueprintCallable, Category="ImGui|Engine Log")
+	static TArray<FImGuiOutputLogEntry> QueryMessagesByIndex(const FString& Query, int32 First, int32 Last = -1);
+
+	/** Messages logged between the two points in time, both inclusive, that match the query. */
+	UFUNCTION(BlueprintCallable, Category="ImGui|Engine Log")
+	static TArray<FImGuiOutputLogEntry> QueryMessagesByTime(const FString& Query, FDateTime From, FDateTime To);
+
+	/** How many messages the log has, which is where the next query by index can start from. */
+	UFUNCTION(BlueprintPure, Category="ImGui|Engine Log")
+	static int32 GetMessagesNum();
+
+private:
+	static TArray<FImGuiOutputLogEntry> RunQuery(const FImGuiOutputLogQueryParams& Params);
+};
@@ -1,3 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include "CoreMinimal.h"
+
+IMGUIOUTPUTLOG_API DECLARE_LOG_CATEGORY_EXTERN(LogImGuiOutputLog, Log, All);